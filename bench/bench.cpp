@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace bench {
+
+const std::filesystem::path directory = "benchmarks";
+
+bool measure(result& out, const benchmark& bench, size_t rounds) NOEXCEPT
+{
+    using namespace system;
+    std::vector<uint64_t> times{};
+    times.reserve(rounds);
+
+    for (size_t round{}; round < rounds; ++round)
+    {
+        if (!file::clear_directory(directory))
+            return false;
+
+        timer time{};
+        const auto success = bench.run(time, bench.operations);
+        /* bool */ file::clear_directory(directory);
+
+        if (!success)
+            return false;
+
+        times.push_back(time.nanoseconds());
+    }
+
+    if (times.empty())
+        return false;
+
+    std::sort(times.begin(), times.end());
+    out.name = bench.name;
+    out.operations = bench.operations;
+    out.rounds = rounds;
+    out.best = times.front();
+    out.median = times.at(to_half(times.size()));
+    return true;
+}
+
+void report_header(std::ostream& stream) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream
+        << "benchmark" << '\t'
+        << "operations" << '\t'
+        << "rounds" << '\t'
+        << "best_ns" << '\t'
+        << "median_ns" << '\t'
+        << "ns_per_op" << '\t'
+        << "ops_per_sec" << std::endl;
+    BC_POP_WARNING()
+}
+
+void report(std::ostream& stream, const result& value) NOEXCEPT
+{
+    using namespace system;
+    const auto operations = std::max(value.operations, one);
+    const auto per_op = static_cast<double>(value.best) / operations;
+    const auto per_second = is_zero(value.best) ? 0.0 :
+        1e9 * operations / static_cast<double>(value.best);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream
+        << value.name << '\t'
+        << value.operations << '\t'
+        << value.rounds << '\t'
+        << value.best << '\t'
+        << value.median << '\t'
+        << std::fixed << std::setprecision(1) << per_op << '\t'
+        << std::fixed << std::setprecision(0) << per_second << std::endl;
+    BC_POP_WARNING()
+}
+
+} // namespace bench
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_BENCH_BENCH_HPP
+#define LIBBITCOIN_DATABASE_BENCH_BENCH_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+#include <bitcoin/database.hpp>
+
+namespace bench {
+
+using namespace bc;
+using namespace bc::database;
+
+/// Common directory for all benchmark file creations (cleared per round).
+extern const std::filesystem::path directory;
+
+/// Accumulates measured time across start/stop pairs, so that setup and
+/// verification within a round are excluded from the result.
+class timer
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    inline void start() NOEXCEPT
+    {
+        start_ = clock::now();
+    }
+
+    inline void stop() NOEXCEPT
+    {
+        elapsed_ += clock::now() - start_;
+    }
+
+    inline uint64_t nanoseconds() const NOEXCEPT
+    {
+        using namespace std::chrono;
+        return system::possible_sign_cast<uint64_t>(
+            duration_cast<std::chrono::nanoseconds>(elapsed_).count());
+    }
+
+private:
+    clock::time_point start_{};
+    clock::duration elapsed_{};
+};
+
+/// File-backed storage created, opened and loaded for one benchmark round.
+/// Random selects preloaded (head) advice, staged selects the staging backend.
+class loaded_map
+  : public map
+{
+public:
+    loaded_map(const std::string& name, bool random=true,
+        bool staged=false) NOEXCEPT
+      : map(directory / name, {}, random, staged),
+        loaded_(file::create_file(file()) && !open() && !load())
+    {
+    }
+
+    ~loaded_map() NOEXCEPT override
+    {
+        /* code */ unload();
+        /* code */ close();
+    }
+
+    inline bool loaded() const NOEXCEPT
+    {
+        return loaded_;
+    }
+
+private:
+    const bool loaded_;
+};
+
+/// A benchmark performs a fixed count of operations per round, timing only
+/// the measured region. False return implies failure (round is discarded).
+struct benchmark
+{
+    using runner = std::function<bool(timer&, size_t operations)>;
+
+    std::string name;
+    size_t operations;
+    runner run;
+};
+
+using benchmarks = std::vector<benchmark>;
+
+/// Measured result of all rounds of one benchmark.
+struct result
+{
+    std::string name;
+    size_t operations;
+    size_t rounds;
+    uint64_t best;
+    uint64_t median;
+};
+
+/// Run all rounds of the benchmark, false if any round fails.
+bool measure(result& out, const benchmark& bench, size_t rounds) NOEXCEPT;
+
+/// Write the column header and results as tab separated lines (stable
+/// format for regression tracking).
+void report_header(std::ostream& stream) NOEXCEPT;
+void report(std::ostream& stream, const result& value) NOEXCEPT;
+
+/// Registration (one per benchmark source).
+void primitives(benchmarks& out) NOEXCEPT;
+void memory(benchmarks& out) NOEXCEPT;
+void queries(benchmarks& out) NOEXCEPT;
+
+} // namespace bench
+
+#endif
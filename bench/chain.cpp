@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "chain.hpp"
+
+#include "../test/mocks/blocks.hpp"
+
+namespace bench {
+
+using namespace system;
+using namespace system::chain;
+
+constexpr uint32_t version = 1;
+constexpr uint32_t bits = 0x1d00ffff;
+constexpr uint64_t subsidy = 50'0000'0000;
+constexpr uint64_t value = 1'0000;
+
+const blocks& seed() NOEXCEPT
+{
+    static const blocks seeds
+    {
+        test::block1, test::block2, test::block3,
+        test::block4, test::block5, test::block6,
+        test::block7, test::block8, test::block9
+    };
+
+    return seeds;
+}
+
+script to_script(size_t address) NOEXCEPT
+{
+    const auto hash = bitcoin_short_hash(to_little_endian<uint64_t>(address));
+    return script{ script::to_pay_key_hash_pattern(hash) };
+}
+
+hash_digest to_address(size_t address) NOEXCEPT
+{
+    return to_script(address).hash();
+}
+
+static transaction coinbase(size_t height, size_t address) NOEXCEPT
+{
+    // Height as locktime and sequence makes each coinbase unique.
+    const auto unique = possible_narrow_cast<uint32_t>(height);
+    return transaction
+    {
+        version,
+        inputs
+        {
+            input{ point{}, script{}, witness{}, unique }
+        },
+        outputs
+        {
+            output{ subsidy, to_script(address) }
+        },
+        unique
+    };
+}
+
+static transaction spend(const point& prevout, size_t first,
+    size_t second) NOEXCEPT
+{
+    return transaction
+    {
+        version,
+        inputs
+        {
+            input{ prevout, script{}, witness{}, max_uint32 }
+        },
+        outputs
+        {
+            output{ value, to_script(first) },
+            output{ value, to_script(second) }
+        },
+        0
+    };
+}
+
+blocks synthesize(const shape& config) NOEXCEPT
+{
+    blocks out{};
+    out.reserve(config.count);
+
+    hashes spent(config.width, one_hash);
+    auto previous = test::block9.hash();
+    auto address = zero;
+    const auto next = [&]() NOEXCEPT
+    {
+        address = is_zero(config.addresses) ? zero :
+            add1(address) % config.addresses;
+        return address;
+    };
+
+    for (size_t block{}; block < config.count; ++block)
+    {
+        const auto height = add1(seed_height) + block;
+
+        transactions txs{};
+        txs.reserve(add1(config.width));
+        txs.push_back(coinbase(height, next()));
+
+        for (size_t tx{}; tx < config.width; ++tx)
+        {
+            const auto first = next();
+            txs.push_back(spend(point{ spent.at(tx), 0 }, first, next()));
+            spent.at(tx) = txs.back().hash(false);
+        }
+
+        const auto time = possible_narrow_cast<uint32_t>(height);
+        out.emplace_back(header
+        {
+            version,
+            previous,
+            null_hash,
+            time,
+            bits,
+            time
+        }, std::move(txs));
+
+        previous = out.back().hash();
+    }
+
+    return out;
+}
+
+} // namespace bench
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_BENCH_CHAIN_HPP
+#define LIBBITCOIN_DATABASE_BENCH_CHAIN_HPP
+
+#include <vector>
+#include "bench.hpp"
+
+namespace bench {
+
+using blocks = std::vector<system::chain::block>;
+
+/// Deterministic synthetic chain shape.
+struct shape
+{
+    /// Blocks above the seed chain (test::block1...block9).
+    size_t count{ 32 };
+
+    /// Non-coinbase transactions per block (one input, two outputs each).
+    size_t width{ 1024 };
+
+    /// Distinct output scripts, reused round robin across outputs.
+    size_t addresses{ 4096 };
+};
+
+/// Height of the last seed block (test::block9), synthetic blocks follow.
+constexpr size_t seed_height = 9;
+
+/// Seed blocks test::block1...block9, the mainnet chain above genesis.
+const blocks& seed() NOEXCEPT;
+
+/// Synthesize the chain above the seed. Each non-coinbase tx spends the first
+/// output of the corresponding tx of the previous synthetic block (the first
+/// block spends outputs that do not exist, as for headers-first archival).
+blocks synthesize(const shape& config) NOEXCEPT;
+
+/// Output script and its address (script hash) key for index.
+system::chain::script to_script(size_t address) NOEXCEPT;
+system::hash_digest to_address(size_t address) NOEXCEPT;
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "bench.hpp"
+
+// bench [filter] [rounds]
+// Runs each benchmark with name containing filter (all by default) for the
+// specified number of rounds (three by default), reporting the best and the
+// median round as tab separated lines on stdout, failures on stderr.
+int main(int argc, char* argv[])
+{
+    using namespace bench;
+    constexpr size_t default_rounds = 3;
+    const std::string filter{ argc > 1 ? argv[1] : "" };
+    const auto parsed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 0u;
+    const auto rounds = is_zero(parsed) ? default_rounds :
+        system::possible_narrow_cast<size_t>(parsed);
+
+    benchmarks all{};
+    primitives(all);
+    memory(all);
+    queries(all);
+
+    auto failed = false;
+    report_header(std::cout);
+    for (const auto& bench: all)
+    {
+        if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+            continue;
+
+        result value{};
+        if (measure(value, bench, rounds))
+        {
+            report(std::cout, value);
+        }
+        else
+        {
+            std::cerr << bench.name << '\t' << "failed" << std::endl;
+            failed = true;
+        }
+    }
+
+    return failed ? -1 : 0;
+}
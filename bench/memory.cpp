@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <algorithm>
+
+namespace bench {
+
+using namespace system;
+
+// Bytes per allocation (a typical small archive row).
+constexpr size_t row = 64;
+
+// mmap
+// ----------------------------------------------------------------------------
+// Staged instances exercise the staging backend (where built), unstaged
+// instances the resident (head) path, as configured by the store.
+
+static bool allocate(timer& time, size_t operations, bool staged) NOEXCEPT
+{
+    loaded_map body{ "mmap_allocate", false, staged };
+    if (!body.loaded())
+        return false;
+
+    auto success = true;
+    time.start();
+    for (size_t index{}; index < operations; ++index)
+        success &= (body.allocate(row) != map::eof);
+
+    time.stop();
+    return success && !body.get_fault();
+}
+
+static bool mmap_allocate(timer& time, size_t operations) NOEXCEPT
+{
+    return allocate(time, operations, false);
+}
+
+static bool mmap_allocate_staged(timer& time, size_t operations) NOEXCEPT
+{
+    return allocate(time, operations, true);
+}
+
+static bool complete(timer& time, size_t operations, bool staged) NOEXCEPT
+{
+    loaded_map body{ "mmap_complete", false, staged };
+    if (!body.loaded())
+        return false;
+
+    // Rows are allocated and written before their measured completion.
+    std::vector<size_t> offsets(operations);
+    for (auto& offset: offsets)
+    {
+        offset = body.allocate(row);
+        if (offset == map::eof)
+            return false;
+
+        const auto ptr = body.get(offset);
+        if (!ptr)
+            return false;
+
+        std::fill_n(ptr.data(), row, bit_all<uint8_t>);
+    }
+
+    time.start();
+    for (const auto offset: offsets)
+        body.complete(offset, row);
+
+    time.stop();
+    return body.frontier() == body.size();
+}
+
+static bool mmap_complete(timer& time, size_t operations) NOEXCEPT
+{
+    return complete(time, operations, false);
+}
+
+static bool mmap_complete_staged(timer& time, size_t operations) NOEXCEPT
+{
+    return complete(time, operations, true);
+}
+
+static bool mmap_get(timer& time, size_t operations) NOEXCEPT
+{
+    loaded_map body{ "mmap_get", false };
+    if (!body.loaded() || body.allocate(operations * row) == map::eof)
+        return false;
+
+    auto found = zero;
+    time.start();
+    for (size_t index{}; index < operations; ++index)
+        if (body.get(index * row))
+            ++found;
+
+    time.stop();
+    return found == operations;
+}
+
+// registration
+// ----------------------------------------------------------------------------
+
+void memory(benchmarks& out) NOEXCEPT
+{
+    constexpr auto operations = power2(20_size);
+
+    out.push_back({ "mmap__allocate", operations, mmap_allocate });
+    out.push_back({ "mmap__allocate_staged", operations, mmap_allocate_staged });
+    out.push_back({ "mmap__complete", operations, mmap_complete });
+    out.push_back({ "mmap__complete_staged", operations, mmap_complete_staged });
+    out.push_back({ "mmap__get", operations, mmap_get });
+}
+
+} // namespace bench
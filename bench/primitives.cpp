@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+namespace bench {
+
+using namespace system;
+using link = linkage<4>;
+using key = hash_digest;
+
+// Four byte record, the minimal payload (isolates primitive overhead).
+class record
+{
+public:
+    static constexpr size_t size = sizeof(uint32_t);
+    static constexpr link count() NOEXCEPT { return 1; }
+
+    bool from_data(database::reader& source) NOEXCEPT
+    {
+        value = source.read_little_endian<uint32_t>();
+        return source;
+    }
+
+    bool to_data(database::finalizer& sink) const NOEXCEPT
+    {
+        sink.write_little_endian(value);
+        return sink;
+    }
+
+    uint32_t value{};
+};
+
+using hash_table = hashmap<link, key, record::size>;
+using hash_head = hashhead<link, key>;
+using array_table = arraymap<link, record::size, false>;
+using record_table = nomap<link, record::size>;
+
+// Keys are hashes of the operation index (uniform over buckets).
+static std::vector<key> make_keys(size_t count) NOEXCEPT
+{
+    std::vector<key> keys(count);
+    for (size_t index{}; index < count; ++index)
+        keys.at(index) = sha256_hash(to_little_endian<uint64_t>(index));
+
+    return keys;
+}
+
+// Buckets are sized to the row count (average chain length of one).
+static link to_buckets(size_t operations) NOEXCEPT
+{
+    return possible_narrow_cast<link::integer>(operations);
+}
+
+// hashmap
+// ----------------------------------------------------------------------------
+
+static bool hashmap_put(timer& time, size_t operations) NOEXCEPT
+{
+    const auto keys = make_keys(operations);
+    loaded_map head{ "hashmap_put_head" };
+    loaded_map body{ "hashmap_put_body", false };
+    hash_table table{ head, body, to_buckets(operations) };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    auto success = true;
+    time.start();
+    for (size_t index{}; index < operations; ++index)
+        success &= table.put(keys.at(index), record{});
+
+    time.stop();
+    return success;
+}
+
+static bool hashmap_first(timer& time, size_t operations) NOEXCEPT
+{
+    const auto keys = make_keys(operations);
+    loaded_map head{ "hashmap_first_head" };
+    loaded_map body{ "hashmap_first_body", false };
+    hash_table table{ head, body, to_buckets(operations) };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    for (const auto& key: keys)
+        if (!table.put(key, record{}))
+            return false;
+
+    auto found = zero;
+    time.start();
+    for (const auto& key: keys)
+        if (!table.first(key).is_terminal())
+            ++found;
+
+    time.stop();
+    return found == operations;
+}
+
+static bool hashmap_commit(timer& time, size_t operations) NOEXCEPT
+{
+    const auto keys = make_keys(operations);
+    loaded_map head{ "hashmap_commit_head" };
+    loaded_map body{ "hashmap_commit_body", false };
+    hash_table table{ head, body, to_buckets(operations) };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    // Rows are allocated and set (unsearchable) before the measured commit.
+    const auto first = table.allocate(to_buckets(operations));
+    if (first.is_terminal())
+        return false;
+
+    auto row = first;
+    for (const auto& key: keys)
+        if (!table.set(row++, key, record{}))
+            return false;
+
+    auto success = true;
+    row = first;
+    time.start();
+    for (const auto& key: keys)
+        success &= table.commit(row++, key);
+
+    time.stop();
+    return success;
+}
+
+// hashhead
+// ----------------------------------------------------------------------------
+
+static bool hashhead_push(timer& time, size_t operations) NOEXCEPT
+{
+    const auto keys = make_keys(operations);
+    loaded_map store{ "hashhead_push" };
+    hash_head head{ store, to_buckets(operations) };
+    if (!store.loaded() || !head.create())
+        return false;
+
+    auto success = true;
+    link::bytes next{};
+    time.start();
+    for (size_t index{}; index < operations; ++index)
+        success &= head.push(link{ possible_narrow_cast<link::integer>(index) },
+            next, keys.at(index));
+
+    time.stop();
+    return success;
+}
+
+static bool hashhead_top(timer& time, size_t operations) NOEXCEPT
+{
+    const auto keys = make_keys(operations);
+    loaded_map store{ "hashhead_top" };
+    hash_head head{ store, to_buckets(operations) };
+    if (!store.loaded() || !head.create())
+        return false;
+
+    link::bytes next{};
+    for (size_t index{}; index < operations; ++index)
+        if (!head.push(link{ possible_narrow_cast<link::integer>(index) },
+            next, keys.at(index)))
+            return false;
+
+    auto found = zero;
+    time.start();
+    for (const auto& key: keys)
+        if (!head.top(key).is_terminal())
+            ++found;
+
+    time.stop();
+    return found == operations;
+}
+
+// arraymap
+// ----------------------------------------------------------------------------
+
+static bool arraymap_put(timer& time, size_t operations) NOEXCEPT
+{
+    loaded_map head{ "arraymap_put_head" };
+    loaded_map body{ "arraymap_put_body", false };
+    array_table table{ head, body, to_buckets(operations) };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    auto success = true;
+    time.start();
+    for (size_t key{}; key < operations; ++key)
+        success &= table.put(key, record{});
+
+    time.stop();
+    return success;
+}
+
+static bool arraymap_at(timer& time, size_t operations) NOEXCEPT
+{
+    loaded_map head{ "arraymap_at_head" };
+    loaded_map body{ "arraymap_at_body", false };
+    array_table table{ head, body, to_buckets(operations) };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    for (size_t key{}; key < operations; ++key)
+        if (!table.put(key, record{}))
+            return false;
+
+    auto found = zero;
+    time.start();
+    for (size_t key{}; key < operations; ++key)
+        if (!table.at(key).is_terminal())
+            ++found;
+
+    time.stop();
+    return found == operations;
+}
+
+// nomap
+// ----------------------------------------------------------------------------
+
+static bool nomap_allocate(timer& time, size_t operations) NOEXCEPT
+{
+    loaded_map head{ "nomap_allocate_head" };
+    loaded_map body{ "nomap_allocate_body", false };
+    record_table table{ head, body };
+    if (!head.loaded() || !body.loaded() || !table.create())
+        return false;
+
+    auto success = true;
+    time.start();
+    for (size_t index{}; index < operations; ++index)
+        success &= !table.allocate(one).is_terminal();
+
+    time.stop();
+    return success;
+}
+
+// registration
+// ----------------------------------------------------------------------------
+
+void primitives(benchmarks& out) NOEXCEPT
+{
+    constexpr auto lookups = power2(20_size);
+    constexpr auto writes = power2(18_size);
+
+    out.push_back({ "hashmap__put", writes, hashmap_put });
+    out.push_back({ "hashmap__first", lookups, hashmap_first });
+    out.push_back({ "hashmap__commit", writes, hashmap_commit });
+    out.push_back({ "hashhead__push", lookups, hashhead_push });
+    out.push_back({ "hashhead__top", lookups, hashhead_top });
+    out.push_back({ "arraymap__put", writes, arraymap_put });
+    out.push_back({ "arraymap__at", lookups, arraymap_at });
+    out.push_back({ "nomap__allocate", lookups, nomap_allocate });
+}
+
+} // namespace bench
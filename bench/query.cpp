@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "chain.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include "../test/mocks/blocks.hpp"
+
+namespace bench {
+
+using namespace system;
+using store_t = database::store<database::mmap>;
+using query_t = database::query<store_t>;
+
+static const auto events = [](auto, auto) {};
+
+// Buckets sized to the synthetic chain (average chain length about one).
+static settings configure(const std::string& name, const shape& config) NOEXCEPT
+{
+    const auto txs = possible_narrow_cast<uint32_t>(
+        add1(config.width) * (config.count + seed().size() + one));
+
+    settings out{};
+    out.path = directory / name;
+    out.header.buckets = possible_narrow_cast<uint32_t>(
+        config.count + seed().size() + one);
+    out.tx.buckets = txs;
+    out.ins.buckets = txs;
+    out.outs.buckets = possible_narrow_cast<uint32_t>(txs * two);
+    out.txs.buckets = out.header.buckets;
+    out.strong_tx.buckets = txs;
+    return out;
+}
+
+// Store over file-backed maps, created, initialized and closed with scope.
+class fixture
+{
+public:
+    fixture(const std::string& name, const shape& config) NOEXCEPT
+      : settings_(configure(name, config)),
+        store_(settings_),
+        query_(store_),
+        created_(file::clear_directory(settings_.path) &&
+            !store_.create(events) && query_.initialize(test::genesis))
+    {
+    }
+
+    ~fixture() NOEXCEPT
+    {
+        /* code */ store_.close(events);
+    }
+
+    inline bool created() const NOEXCEPT
+    {
+        return created_;
+    }
+
+    inline query_t& query() NOEXCEPT
+    {
+        return query_;
+    }
+
+    // Archive the seed and the synthetic chain (optionally confirmed).
+    bool archive(const blocks& chain, bool confirm) NOEXCEPT
+    {
+        auto height = zero;
+        const auto set = [&](const system::chain::block& block) NOEXCEPT
+        {
+            const auto next = possible_narrow_cast<uint32_t>(++height);
+            const database::context ctx{ 0, next, 0 };
+            if (query_.set_code(block, ctx, false, false))
+                return false;
+
+            return !confirm || query_.push_confirmed(
+                query_.to_header(block.hash()), true);
+        };
+
+        return std::all_of(seed().begin(), seed().end(), set) &&
+            std::all_of(chain.begin(), chain.end(), set);
+    }
+
+private:
+    const settings settings_;
+    store_t store_;
+    query_t query_;
+    const bool created_;
+};
+
+// query
+// ----------------------------------------------------------------------------
+
+// Operations are synthetic blocks (each config.width + 1 txs).
+static const shape& chain_shape() NOEXCEPT
+{
+    static const shape config{};
+    return config;
+}
+
+static const blocks& synthetic_chain() NOEXCEPT
+{
+    static const auto chain = synthesize(chain_shape());
+    return chain;
+}
+
+static bool query_set_code_block(timer& time, size_t) NOEXCEPT
+{
+    fixture store{ "set_code_block", chain_shape() };
+    if (!store.created() || !store.archive({}, false))
+        return false;
+
+    auto& query = store.query();
+    auto height = seed_height;
+    auto success = true;
+    time.start();
+    for (const auto& block: synthetic_chain())
+    {
+        const auto next = possible_narrow_cast<uint32_t>(++height);
+        const database::context ctx{ 0, next, 0 };
+        success &= !query.set_code(block, ctx, false, false);
+    }
+
+    time.stop();
+    return success;
+}
+
+static bool query_block_confirmable(timer& time, size_t) NOEXCEPT
+{
+    fixture store{ "block_confirmable", chain_shape() };
+    if (!store.created() || !store.archive(synthetic_chain(), true))
+        return false;
+
+    // The first synthetic block spends missing prevouts (not confirmable).
+    auto& query = store.query();
+    const auto& chain = synthetic_chain();
+    auto success = true;
+    time.start();
+    for (auto block = std::next(chain.begin()); block != chain.end(); ++block)
+        success &= !query.block_confirmable(query.to_header(block->hash()));
+
+    time.stop();
+    return success;
+}
+
+static bool query_get_history(timer& time, size_t operations) NOEXCEPT
+{
+    fixture store{ "get_history", chain_shape() };
+    if (!store.created() || !store.archive(synthetic_chain(), true))
+        return false;
+
+    std::vector<hash_digest> keys(operations);
+    for (size_t address{}; address < operations; ++address)
+        keys.at(address) = to_address(address);
+
+    auto& query = store.query();
+    const std::atomic_bool cancel{};
+    auto success = true;
+    time.start();
+    for (const auto& key: keys)
+    {
+        histories out{};
+        height_link cursor{};
+        success &= !query.get_history(cancel, cursor, out, key) &&
+            !out.empty();
+    }
+
+    time.stop();
+    return success;
+}
+
+static bool query_get_wire_block(timer& time, size_t) NOEXCEPT
+{
+    fixture store{ "get_wire_block", chain_shape() };
+    if (!store.created() || !store.archive(synthetic_chain(), true))
+        return false;
+
+    auto& query = store.query();
+    std::vector<header_link> links{};
+    for (const auto& block: synthetic_chain())
+        links.push_back(query.to_header(block.hash()));
+
+    auto success = true;
+    time.start();
+    for (const auto& link: links)
+        success &= !query.get_wire_block(link, true).empty();
+
+    time.stop();
+    return success;
+}
+
+// registration
+// ----------------------------------------------------------------------------
+
+void queries(benchmarks& out) NOEXCEPT
+{
+    const auto& config = chain_shape();
+    const auto blocks = config.count;
+
+    out.push_back({ "query__set_code_block", blocks, query_set_code_block });
+    out.push_back({ "query__block_confirmable", sub1(blocks),
+        query_block_confirmable });
+    out.push_back({ "query__get_history", config.addresses,
+        query_get_history });
+    out.push_back({ "query__get_wire_block", blocks, query_get_wire_block });
+}
+
+} // namespace bench
@@ -78,13 +78,18 @@
 #include <bitcoin/database/tables/caches/validated_bk.hpp>
 #include <bitcoin/database/tables/caches/validated_tx.hpp>
 #include <bitcoin/database/tables/indexes/height.hpp>
+#include <bitcoin/database/tables/indexes/strong_array.hpp>
 #include <bitcoin/database/tables/indexes/strong_tx.hpp>
 #include <bitcoin/database/tables/optionals/address.hpp>
 #include <bitcoin/database/tables/optionals/filter_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_tx.hpp>
+#include <bitcoin/database/tables/optionals/layout.hpp>
+#include <bitcoin/database/tables/optionals/summary.hpp>
+#include <bitcoin/database/types/address_summary.hpp>
 #include <bitcoin/database/types/association.hpp>
 #include <bitcoin/database/types/associations.hpp>
 #include <bitcoin/database/types/block_state.hpp>
+#include <bitcoin/database/types/block_stream.hpp>
 #include <bitcoin/database/types/fee_rate.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
@@ -92,6 +97,7 @@
 #include <bitcoin/database/types/point_set.hpp>
 #include <bitcoin/database/types/position.hpp>
 #include <bitcoin/database/types/span.hpp>
+#include <bitcoin/database/types/stored_block.hpp>
 #include <bitcoin/database/types/tx_state.hpp>
 #include <bitcoin/database/types/type.hpp>
 #include <bitcoin/database/types/types.hpp>
@@ -89,6 +89,8 @@ enum error_t : uint8_t
     not_coalesced,
     missing_snapshot,
     unloaded_file,
+    untracked_file,
+    invalid_delta,
 
     /// tables
     create_table,
@@ -97,6 +99,10 @@ enum error_t : uint8_t
     backup_table,
     restore_table,
     verify_table,
+    rehash_table,
+    strong_mode,
+    unbuilt_table,
+    fingerprint_width,
 
     /// validation/confirmation
     tx_connected,
@@ -133,6 +139,7 @@ enum error_t : uint8_t
     txs_height,
     txs_confirm,
     txs_txs_put,
+    txs_layout_put,
 
     /// services
     not_found,
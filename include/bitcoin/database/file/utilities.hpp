@@ -20,6 +20,9 @@
 #define LIBBITCOIN_DATABASE_FILE_UTILITIES_HPP
 
 #include <filesystem>
+#include <functional>
+#include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/settings.hpp>
 
@@ -29,6 +32,9 @@ namespace file {
 
 constexpr auto invalid = -1;
 using path = std::filesystem::path;
+using progress = std::function<void(size_t bytes)>;
+using span = std::pair<size_t, size_t>;
+using spans = std::vector<span>;
 
 /// True only if directory existed.
 BCD_API bool is_directory(const path& directory) NOEXCEPT;
@@ -54,6 +60,19 @@ BCD_API bool create_file(const path& to, const uint8_t* data,
 BCD_API code create_file_ex(const path& to, const uint8_t* data,
     size_t size) NOEXCEPT;
 
+/// Create/open file and initialize/replace with size/data, streamed in writes
+/// of up to chunk bytes, with bytes of each completed write sent to handler.
+BCD_API code create_file_ex(const path& to, const uint8_t* data,
+    size_t size, size_t chunk, const progress& handler) NOEXCEPT;
+
+/// Create/open delta file and initialize/replace with the size of data and
+/// the (offset, size) spans of data, with bytes of each span sent to handler.
+BCD_API code create_delta_ex(const path& to, const uint8_t* data, size_t size,
+    const spans& changes, const progress& handler) NOEXCEPT;
+
+/// Apply delta file to existing file, resizing it to the delta data size.
+BCD_API code apply_delta_ex(const path& to, const path& delta) NOEXCEPT;
+
 /// Delete file or empty directory, false on error only.
 BCD_API bool remove(const path& name) NOEXCEPT;
 BCD_API code remove_ex(const path& name) NOEXCEPT;
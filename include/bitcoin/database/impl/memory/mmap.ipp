@@ -43,6 +43,8 @@ CLASS::mmap(const path& filename, const storage_settings& settings,
     access_(settings.access),
     random_(random),
     staged_(staged),
+    huge_(settings.huge),
+    interleave_(settings.interleave),
     opened_{ file::invalid }
 {
 }
@@ -58,6 +60,8 @@ CLASS::mmap(const paths& filenames, const storage_settings& settings,
     access_(settings.access),
     random_(random),
     staged_(staged),
+    huge_(settings.huge),
+    interleave_(settings.interleave),
     opened_{}
 {
     opened_.fill(file::invalid);
@@ -212,6 +216,7 @@ void CLASS::check_invariants_() const NOEXCEPT
 TEMPLATE
 void CLASS::set_first_code(const error::error_t& ec) NOEXCEPT
 {
+    faults_.fetch_add(one, relaxed);
     if (!fault_.load())
     {
         fault_.store(true);
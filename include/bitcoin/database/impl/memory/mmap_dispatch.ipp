@@ -26,6 +26,8 @@
 #include <shared_mutex>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/file/file.hpp>
+#include <bitcoin/database/memory/mman.hpp>
+#include <bitcoin/database/memory/utilities.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -136,6 +138,43 @@ memory CLASS::get_at(size_t column, size_t offset) const NOEXCEPT
     return out;
 }
 
+#if !defined(HAVE_MSC) && !defined(WITHOUT_MADVISE)
+TEMPLATE
+bool CLASS::willneed(size_t offset, size_t size,
+    size_t column) const NOEXCEPT
+{
+    using namespace system;
+    if (is_zero(size) || column >= columns)
+        return false;
+
+    // Takes a shared lock on remap_mutex_ for the advice (map is stable).
+    const auto ptr = get_at(column, offset);
+    if (!ptr || ptr.size() <= 0)
+        return false;
+
+    // Advice applies to whole pages, and maps are page aligned, so the range
+    // start is floored to its page by the offset remainder.
+    const auto page = page_size();
+    if (is_zero(page))
+        return false;
+
+    const auto skew = offset % page;
+    const auto limit = possible_narrow_sign_cast<size_t>(ptr.size());
+    const auto length = std::min(size, limit) + skew;
+
+    // WILLNEED initiates read-ahead of file-backed pages and returns, so
+    // settled rows become resident without blocking the caller on the read.
+    return ::madvise(std::prev(ptr.data(), skew), length,
+        MADV_WILLNEED) != fail;
+}
+#else
+TEMPLATE
+bool CLASS::willneed(size_t, size_t, size_t) const NOEXCEPT
+{
+    return false;
+}
+#endif
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -57,7 +57,11 @@ bool CLASS::map_all_(std::index_sequence<Index...>) NOEXCEPT
         return false;
     }
 
+    // Huge pages fall back to the page where the system does not provide
+    // them (granularity only, conversions remain correct at any granule).
+    const auto huge = huge_ ? huge_page_size() : zero;
     page_ = page;
+    granule_ = std::max(page, huge);
     window_.store(zero);
     settled_.store(staged_ ? logical_.load() : zero);
     frontier_.store(staged_ ? logical_.load() : zero);
@@ -95,6 +99,8 @@ bool CLASS::unmap_all_(std::index_sequence<Index...>) NOEXCEPT
     frontier_.store(zero);
     marks_.store(zero);
     dirty_.reset();
+    changed_.reset();
+    tracking_.store(false);
     intent_.reset();
     released_.reset();
     sweep_.reset();
@@ -140,6 +146,7 @@ bool CLASS::remap_all_(size_t capacity, std::index_sequence<Index...>,
     // within), so the extent tracks the high water of provisioning.
     file_.store(std::max(file_.load(), capacity));
     capacity_.store(capacity);
+    remaps_.fetch_add(one, relaxed);
     check_invariants_();
     return true;
 }
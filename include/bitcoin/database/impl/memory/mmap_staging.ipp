@@ -22,10 +22,6 @@
 #include <algorithm>
 #include <chrono>
 #include <fcntl.h>
-#if defined(STAGING_TELEMETRY)
-    #include <iostream>
-    #include <sstream>
-#endif
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/mstage.hpp>
 #include <bitcoin/database/memory/utilities.hpp>
@@ -158,6 +154,43 @@ size_t CLASS::frontier() const NOEXCEPT
     return size();
 }
 
+// The settler drains to the frontier while the throttle measures debt to
+// logical, so lag exposes a pinned frontier and debt the throttle pressure.
+TEMPLATE
+storage_stats CLASS::stats() const NOEXCEPT
+{
+    using namespace system;
+    storage_stats out{};
+    out.logical = logical_.load(relaxed);
+    out.frontier = out.logical;
+    out.settled = out.logical;
+    out.remaps = remaps_.load(relaxed);
+    out.faults = faults_.load(relaxed);
+    for (size_t bin{}; bin < storage_stats::flush_bins; ++bin)
+        out.flush_durations.at(bin) = flushes_.at(bin).load(relaxed);
+
+#if defined(MANAGE_STAGING)
+    if (staged_)
+    {
+        out.frontier = frontier_.load(relaxed);
+        out.settled = settled_.load(relaxed);
+        const auto window = unpack_word<uint64_t>(window_.load(relaxed));
+        out.window = std::get<1>(window);
+    }
+
+    out.settle_bytes = settle_bytes_.load(relaxed);
+    out.evict_bytes = evict_bytes_.load(relaxed);
+    out.throttle_waits = throttle_waits_.load(relaxed);
+    out.ring_spins = ring_spins_.load(relaxed);
+    out.released_pages = pages_released_.load(relaxed);
+    out.restored_pages = pages_restored_.load(relaxed);
+#endif
+
+    out.lag = floored_subtract(out.logical, out.frontier);
+    out.debt = floored_subtract(out.logical, out.settled);
+    return out;
+}
+
 #if defined(MANAGE_STAGING)
 
 // Claim and record an extent under one lock: a claim never exists outside
@@ -186,6 +219,7 @@ size_t CLASS::record_(size_t count) NOEXCEPT
         if (fault_.load() || !is_zero(space_.load()))
             return storage::eof;
 
+        ring_spins_.fetch_add(one, relaxed);
         std::this_thread::yield();
         maintain_();
         std::tie(head, size) = unpack_word<uint64_t>(window_.load(relaxed));
@@ -274,6 +308,7 @@ void CLASS::throttle_() NOEXCEPT
 
     std::unique_lock throttle_lock(throttle_mutex_);
 
+    throttle_waits_.fetch_add(one, relaxed);
     throttle_cv_.wait(throttle_lock, relieved);
 }
 
@@ -299,6 +334,8 @@ bool CLASS::settle_all_(size_t rows, std::index_sequence<Index...>) NOEXCEPT
     if (!(settle_<Index>(from, rows) && ...))
         return false;
 
+    settle_bytes_.fetch_add(system::ceilinged_multiply(
+        system::floored_subtract(rows, from), stride), relaxed);
     settled_.store(rows);
     signal_();
     check_invariants_();
@@ -321,7 +358,12 @@ template <size_t... Index>
 bool CLASS::evict_all_(size_t from, size_t to,
     std::index_sequence<Index...>) NOEXCEPT
 {
-    return (evict_<Index>(from, to) && ...);
+    if (!(evict_<Index>(from, to) && ...))
+        return false;
+
+    evict_bytes_.fetch_add(system::ceilinged_multiply(
+        system::floored_subtract(to, from), stride), relaxed);
+    return true;
 }
 
 // staging wrappers, not thread safe.
@@ -348,7 +390,7 @@ bool CLASS::stage_() NOEXCEPT
     // that commitment growth never migrates the mapping (base is stable).
     const auto reserved = page_ceiling(to_width<Column>(
         to_reservation(provision)));
-    const auto base = mmap_reserve(reserved);
+    const auto base = reserve_(reserved);
 
     if (base == MAP_FAILED)
     {
@@ -371,6 +413,8 @@ bool CLASS::stage_() NOEXCEPT
             const auto pages = ceilinged_divide(reserved, page_);
             words_ = ceilinged_divide(pages, page_bound);
             dirty_ = std::make_unique<dirty_bitmaps>(words_);
+            changed_ = std::make_unique<dirty_bitmaps>(words_);
+            tracking_.store(false);
             intent_ = std::make_unique<dirty_bitmaps>(words_);
             released_ = std::make_unique<dirty_bitmaps>(words_);
             sweep_ = std::make_unique<uint64_t[]>(words_);
@@ -443,7 +487,7 @@ bool CLASS::stage_() NOEXCEPT
     {
         const auto chunk = std::min(logical - at, settle_chunk);
         if (!pread_all(opened_[Column],
-            std::next(memory_map_[Column], at), chunk, at))
+            std::next(memory_map_[Column], at), chunk, at, io_depth))
         {
             teardown_<Column>(error::fsync_failure);
             return false;
@@ -484,7 +528,7 @@ bool CLASS::lazy_install_() NOEXCEPT
 
     const auto reserved = page_ceiling(to_width<zero>(
         to_reservation(to_provision())));
-    const auto base = mmap_reserve(reserved);
+    const auto base = reserve_(reserved);
     if (base == MAP_FAILED)
     {
         set_first_code(error::mmap_failure);
@@ -498,6 +542,8 @@ bool CLASS::lazy_install_() NOEXCEPT
     const auto pages = ceilinged_divide(reserved, page_);
     words_ = ceilinged_divide(pages, page_bound);
     dirty_ = std::make_unique<dirty_bitmaps>(words_);
+    changed_ = std::make_unique<dirty_bitmaps>(words_);
+    tracking_.store(false);
     intent_ = std::make_unique<dirty_bitmaps>(words_);
     released_ = std::make_unique<dirty_bitmaps>(words_);
     sweep_ = std::make_unique<uint64_t[]>(words_);
@@ -652,7 +698,7 @@ bool CLASS::commit_(size_t size, bool final) NOEXCEPT
 
     // Reservation exhausted, so reserve larger and migrate (rare by sizing).
     const auto reserved = page_ceiling(to_width<Column>(to_reservation(size)));
-    const auto replace = mmap_reserve(reserved);
+    const auto replace = reserve_(reserved);
 
     if (replace == MAP_FAILED)
     {
@@ -742,12 +788,18 @@ bool CLASS::commit_(size_t size, bool final) NOEXCEPT
             const auto pages = ceilinged_divide(reserved, page_);
             const auto words = ceilinged_divide(pages, page_bound);
             auto grown = std::make_unique<dirty_bitmaps>(words);
+            auto changes = std::make_unique<dirty_bitmaps>(words);
 
             for (size_t word{}; word < std::min(words_, words); ++word)
+            {
                 grown[word].store(dirty_[word].load(relaxed),
                     relaxed);
+                changes[word].store(changed_[word].load(relaxed),
+                    relaxed);
+            }
 
             dirty_ = std::move(grown);
+            changed_ = std::move(changes);
             words_ = words;
 
             // The replacement reservation is fully anonymous (content was
@@ -840,8 +892,12 @@ bool CLASS::unsettle_(size_t rows) NOEXCEPT
         return false;
     }
 
+    // The replacement is a new (unadvised) vma.
+    if (granule_ != page_)
+        mmap_huge(address, end - begin);
+
     if ((begin < bytes) && !pread_all(opened_[Column], address, bytes - begin,
-        begin))
+        begin, io_depth))
     {
         teardown_<Column>(error::fsync_failure);
         return false;
@@ -934,14 +990,39 @@ TEMPLATE
 size_t CLASS::page_floor(size_t bytes) const NOEXCEPT
 {
     using namespace system;
-    return bit_and(bytes, bit_not(sub1(page_)));
+    return bit_and(bytes, bit_not(sub1(granule_)));
 }
 
 TEMPLATE
 size_t CLASS::page_ceiling(size_t bytes) const NOEXCEPT
 {
     using namespace system;
-    return page_floor(ceilinged_add(bytes, sub1(page_)));
+    return page_floor(ceilinged_add(bytes, sub1(granule_)));
+}
+
+// Huge pages back only aligned spans, so the reservation base is granule
+// aligned and advised (a vma flag inherited by each commitment split). An
+// unsupported advice leaves base pages (the granule is then only coarse).
+// Head reservations may also interleave across nodes (probes arrive from
+// every node), while staged bodies are written and settled locally. Both are
+// placement policy only, so refusal leaves default (first touch) placement.
+TEMPLATE
+void* CLASS::reserve_(size_t size) const NOEXCEPT
+{
+    const auto huge = (granule_ != page_);
+    const auto base = huge ? mmap_reserve(size, granule_) :
+        mmap_reserve(size);
+
+    if (base == MAP_FAILED)
+        return base;
+
+    if (huge)
+        mmap_huge(base, size);
+
+    if (interleave_ && !staged_)
+        mmap_interleave(base, size);
+
+    return base;
 }
 
 // settle scheduler, instance-owned (drains completed writes to clean cache).
@@ -958,12 +1039,58 @@ void CLASS::remark_(size_t offset, size_t size) NOEXCEPT
     while ((page <= end) && ((page / page_bound) < words_))
     {
         const auto bit = system::bit_right<uint64_t>(page % page_bound);
+        changed_[page / page_bound].fetch_or(bit, relaxed);
         dirty_[page++ / page_bound].fetch_or(bit, relaxed);
     }
 
     marks_.fetch_add(one, relaxed);
 }
 
+// Claim changed pages within [0, bytes) as coalesced spans, clearing marks.
+// A partial page at the bound is spanned but retains its mark, as its
+// remainder may be filled before logical grows over it (unmarked growth).
+// Dumps are made under the exclusive transactor, so no marks are racing.
+TEMPLATE
+file::spans CLASS::take_changes_(size_t bytes) const NOEXCEPT
+{
+    using namespace system;
+    file::spans spans{};
+    if (is_zero(bytes) || !changed_)
+        return spans;
+
+    const auto pages = ceilinged_divide(bytes, page_);
+    const auto bound = std::min(words_, ceilinged_divide(pages, page_bound));
+    for (size_t word{}; word < bound; ++word)
+    {
+        const auto bits = changed_[word].exchange(zero, relaxed);
+        for (size_t bit{}; !is_zero(bits) && (bit < page_bound); ++bit)
+        {
+            if (!get_right(bits, bit))
+                continue;
+
+            const auto page = word * page_bound + bit;
+            const auto start = page * page_;
+            if (start >= bytes)
+            {
+                changed_[word].fetch_or(bit_right<uint64_t>(bit), relaxed);
+                continue;
+            }
+
+            const auto end = std::min(start + page_, bytes);
+            if ((end - start) < page_)
+                changed_[word].fetch_or(bit_right<uint64_t>(bit), relaxed);
+
+            if (!spans.empty() && (spans.back().first +
+                spans.back().second == start))
+                spans.back().second += end - start;
+            else
+                spans.emplace_back(start, end - start);
+        }
+    }
+
+    return spans;
+}
+
 // Transfer dirty pages within [0, bytes), clearing marks before content
 // reads so that concurrently remarked pages transfer on the next pass.
 // Marks beyond bytes are retained (backfill above logical transfers when
@@ -981,16 +1108,13 @@ bool CLASS::transfer_(size_t bytes) NOEXCEPT
 
     // Untracked (multi-column unstaged) instances transfer in full.
     if (!dirty_)
-        return pwrite_all(opened_[Column], memory_map_[Column], bytes, zero);
+        return pwrite_all(opened_[Column], memory_map_[Column], bytes, zero,
+            io_depth);
 
+    // Claimed pages coalesce into runs, written as concurrent requests.
+    file::spans runs{};
     size_t from{};
     size_t to{};
-    const auto write = [&]() NOEXCEPT
-    {
-        return (from >= to) || pwrite_all(opened_[Column],
-            std::next(memory_map_[Column], from), to - from, from);
-    };
-
     const auto pages = ceilinged_divide(bytes, page_);
     const auto bound = std::min(words_, ceilinged_divide(pages, page_bound));
     for (size_t word{}; word < bound; ++word)
@@ -1020,29 +1144,25 @@ bool CLASS::transfer_(size_t bytes) NOEXCEPT
                 continue;
             }
 
-            if (!write())
-            {
-                // Restore claimed marks (the failed range, the page that
-                // ended it, and this word's unwritten remainder) so failure
-                // is retryable, not lossy.
-                remark_(from, to - from);
-                remark_(start, end - start);
-                dirty_[word].fetch_or(bits, relaxed);
-                return false;
-            }
+            if (from < to)
+                runs.emplace_back(from, to - from);
 
             from = start;
             to = end;
         }
     }
 
-    if (!write())
-    {
-        remark_(from, to - from);
-        return false;
-    }
+    if (from < to)
+        runs.emplace_back(from, to - from);
 
-    return true;
+    if (pwrite_runs(opened_[Column], memory_map_[Column], runs, io_depth))
+        return true;
+
+    // Restore marks of failed runs so that failure is retryable, not lossy.
+    for (const auto& run: runs)
+        remark_(run.first, run.second);
+
+    return false;
 }
 
 // Durability barrier for the column file.
@@ -1053,6 +1173,20 @@ bool CLASS::sync_() NOEXCEPT
 #if defined(F_FULLFSYNC)
     // non-standard macOS behavior: news.ycombinator.com/item?id=30372218
     return ::fcntl(opened_[Column], F_FULLFSYNC, 0) != fail;
+#elif defined(HAVE_LINUX)
+    // While the file size is unchanged since the last full sync, no metadata
+    // is required to retrieve the data, so data writeback alone is durable
+    // (and avoids the inode journal commit). A concurrent resize can only
+    // understate the recorded size, which costs a later full sync.
+    const auto rows = file_.load();
+    if (synced_[Column].load(relaxed) == rows)
+        return ::fdatasync(opened_[Column]) != fail;
+
+    if (::fsync(opened_[Column]) == fail)
+        return false;
+
+    synced_[Column].store(rows, relaxed);
+    return true;
 #else
     return ::fsync(opened_[Column]) != fail;
 #endif
@@ -1128,34 +1262,6 @@ void CLASS::settler_run_() NOEXCEPT
         still = (top == mark) ? std::min(add1(still), idle_seconds) : zero;
         mark = top;
 
-#if defined(STAGING_TELEMETRY)
-        // The settler drains to the frontier while the throttle measures debt
-        // to logical, so a pinned frontier stops settling while debt grows
-        // (unbounded). lag exposes the pin, debt the throttle pressure. One
-        // string per line, as settler threads share the stream.
-        if (is_zero(++telemetry_ % telemetry_seconds))
-        {
-            using namespace system;
-            const auto settled = settled_.load();
-            const auto frontier = frontier_.load();
-            const auto [head_, size_] = unpack_word<uint64_t>(
-                window_.load(relaxed));
-
-            std::ostringstream line{};
-            line << "staging " << filenames_.front().filename().string()
-                << " logical=" << top
-                << " frontier=" << frontier
-                << " settled=" << settled
-                << " lag=" << floored_subtract(top, frontier)
-                << " debt=" << floored_subtract(top, settled)
-                << " window=" << size_
-                << " head=" << head_
-                << std::endl;
-
-            std::cerr << line.str() << std::flush;
-        }
-#endif
-
         // Scarcity is read directly: clean cache is reclaimable, so the
         // kernel pressure level does not raise while free memory exhausts.
         if (system_free() < scarce)
@@ -1369,7 +1475,8 @@ bool CLASS::release_pages_() NOEXCEPT
     const auto bytes = to_width<zero>(logical_.load());
     const auto pages = bytes / page_;
     const auto bound = std::min(words_, ceilinged_divide(pages, page_bound));
-    const auto chunk = std::max(one, release_chunk / page_);
+    const auto chunk = std::max(one,
+        std::max(release_chunk, granule_) / page_);
 
     std::unique_lock restore_lock(restore_mutex_);
 
@@ -1434,7 +1541,11 @@ bool CLASS::release_pages_() NOEXCEPT
                 set_first_code(error::mmap_failure);
                 return false;
             }
+
+            continue;
         }
+
+        pages_released_.fetch_add(second - first, relaxed);
     }
 
     return true;
@@ -1455,7 +1566,8 @@ void CLASS::restore_(size_t offset, size_t size) NOEXCEPT
     // Segments clamp to full pages below logical (as does release candidacy):
     // the reservation above commitment is inaccessible (installation reads).
     const auto pages = to_width<zero>(logical_.load()) / page_;
-    const auto span = std::max(one, release_chunk / page_);
+    const auto span = std::max(one,
+        std::max(release_chunk, granule_) / page_);
     const auto last = (offset + sub1(size)) / page_;
     auto page = offset / page_;
     page -= (page % span);
@@ -1477,15 +1589,22 @@ void CLASS::restore_(size_t offset, size_t size) NOEXCEPT
         if (!any)
             continue;
 
-        if (mmap_restore(std::next(memory_map_[zero], page * page_),
-            (stop - page) * page_) == fail)
+        const auto address = std::next(memory_map_[zero], page * page_);
+        if (mmap_restore(address, (stop - page) * page_) == fail)
         {
             set_first_code(error::mmap_failure);
             return;
         }
 
+        // The installed copy is a new (unadvised) vma, collapsed to huge
+        // pages in the background once advised.
+        if (granule_ != page_)
+            mmap_huge(address, (stop - page) * page_);
+
         for (auto word = begin; word <= end; ++word)
             released_[word].fetch_and(bit_not(mask(word)));
+
+        pages_restored_.fetch_add(stop - page, relaxed);
     }
 }
 
@@ -1579,7 +1698,7 @@ bool CLASS::settle_write_(size_t from, size_t to,
     return (pwrite_all(opened_[Index],
         std::next(memory_map_[Index], to_width<Index>(from)),
         to_width<Index>(to) - to_width<Index>(from),
-        to_width<Index>(from)) && ...);
+        to_width<Index>(from), io_depth) && ...);
 }
 
 #endif // MANAGE_STAGING
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_DATABASE_MEMORY_MMAP_STORAGE_IPP
 
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <mutex>
 #include <utility>
@@ -252,6 +253,7 @@ TEMPLATE
 code CLASS::flush() NOEXCEPT
 {
     // The suspend-writes contract holds logical_ stable across both phases.
+    const auto start = std::chrono::steady_clock::now();
     size_t rows{};
 
     {
@@ -288,9 +290,26 @@ code CLASS::flush() NOEXCEPT
     }
 #endif
 
+    timed_(start);
     return error::success;
 }
 
+// Bin zero is under one millisecond, bin n (non-zero) under 2^n milliseconds.
+TEMPLATE
+void CLASS::timed_(const std::chrono::steady_clock::time_point& start) NOEXCEPT
+{
+    using namespace system;
+    using namespace std::chrono;
+    const auto elapsed = duration_cast<milliseconds>(
+        steady_clock::now() - start).count();
+    const auto millis = possible_narrow_sign_cast<size_t>(
+        std::max<decltype(elapsed)>(elapsed, 0));
+    const size_t bin = is_zero(millis) ? zero :
+        add1<size_t>(floored_log2(millis));
+    flushes_.at(std::min(bin, sub1(storage_stats::flush_bins)))
+        .fetch_add(one, relaxed);
+}
+
 // Suspend writes before calling.
 TEMPLATE
 code CLASS::unload() NOEXCEPT
@@ -377,12 +396,69 @@ code CLASS::shrink() NOEXCEPT
 TEMPLATE
 code CLASS::dump(const std::filesystem::path& path) const NOEXCEPT
 {
+    return dump(path, {});
+}
+
+// Streams large (page multiple) writes from the map, with progress.
+// A dump is the base of subsequent deltas, so changes reset (tracked).
+TEMPLATE
+code CLASS::dump(const std::filesystem::path& path,
+    const progress& handler) const NOEXCEPT
+{
+    BC_ASSERT(is_one(columns));
+    const auto ptr = get();
+    if (!ptr)
+        return error::unloaded_file;
+
+    if (const auto ec = file::create_file_ex(path, ptr.begin(), ptr.size(),
+        dump_chunk, handler))
+        return ec;
+
+#if defined(MANAGE_STAGING)
+    if (changed_)
+    {
+        /* spans */ take_changes_(ptr.size());
+        tracking_.store(true);
+    }
+#endif
+
+    return error::success;
+}
+
+TEMPLATE
+bool CLASS::tracked() const NOEXCEPT
+{
+#if defined(MANAGE_STAGING)
+    return tracking_.load();
+#else
+    return false;
+#endif
+}
+
+// Writes only pages marked since the last dump (scalar only).
+TEMPLATE
+code CLASS::dump_delta(const std::filesystem::path& STAGING_ONLY(path),
+    const progress& STAGING_ONLY(handler)) const NOEXCEPT
+{
+#if defined(MANAGE_STAGING)
     BC_ASSERT(is_one(columns));
     const auto ptr = get();
     if (!ptr)
         return error::unloaded_file;
 
-    return file::create_file_ex(path, ptr.begin(), ptr.size());
+    if (!changed_ || !tracking_.load())
+        return error::untracked_file;
+
+    // A failed delta loses its claimed marks, so the next must be a dump.
+    const auto ec = file::create_delta_ex(path, ptr.begin(), ptr.size(),
+        take_changes_(ptr.size()), handler);
+    if (ec)
+        tracking_.store(false);
+
+    return ec;
+#else
+    return error::untracked_file;
+#endif
 }
 
 // ----------------------------------------------------------------------------
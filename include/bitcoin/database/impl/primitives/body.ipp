@@ -66,6 +66,18 @@ inline memory::iterator CLASS::get_raw(const Link& link) const NOEXCEPT
         return files_.get_raw_at(Column, position);
 }
 
+TEMPLATE
+template <size_t Column>
+inline bool CLASS::willneed(const Link& link) const NOEXCEPT
+{
+    if (link.is_terminal())
+        return false;
+
+    // A slab size is unknown here, so only its first byte's page is advised.
+    constexpr auto size = is_slab ? one : stride<Column>();
+    return files_.willneed(link_to_position<Column>(link), size, Column);
+}
+
 TEMPLATE
 template <size_t Columns, if_equal<Columns, one>>
 inline memory CLASS::get_capacity(const Link& link) const NOEXCEPT
@@ -161,6 +173,18 @@ void CLASS::complete(const Link& link, const Link& count) NOEXCEPT
     files_.complete(link_to_elements(link), link_to_elements(count));
 }
 
+TEMPLATE
+void CLASS::prepare(const Link& link, const Link& count) NOEXCEPT
+{
+    files_.prepare(link_to_elements(link), link_to_elements(count));
+}
+
+TEMPLATE
+void CLASS::mark(const Link& link, const Link& count) NOEXCEPT
+{
+    files_.mark(link_to_elements(link), link_to_elements(count));
+}
+
 // Errors.
 // ----------------------------------------------------------------------------
 
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHHEAD_IPP
 
 #include <algorithm>
+#include <bit>
 #include <bitcoin/database/define.hpp>
 
 // Heads are not subject to resize/remap and therefore do not require memory
@@ -142,6 +143,12 @@ inline Link CLASS::top(const Key& key) const NOEXCEPT
     return {};
 }
 
+TEMPLATE
+inline void CLASS::prefetch(const Key& key) const NOEXCEPT
+{
+    database::prefetch(file_.get_raw(link_to_position(index(key))));
+}
+
 TEMPLATE
 inline bool CLASS::push(const Link& current, bytes& next,
     const Key& key) NOEXCEPT
@@ -158,6 +165,123 @@ inline bool CLASS::push(bool& collision, const Link& current, bytes& next,
     return set_cell(collision, next, current, key);
 }
 
+// statistics
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+std::vector<size_t> CLASS::partition(size_t& span, size_t ranges) const NOEXCEPT
+{
+    using namespace system;
+    const auto buckets = this->buckets();
+    const auto count = std::clamp(ranges, one, std::max(one, buckets));
+    span = ceilinged_divide(buckets, count);
+
+    std::vector<size_t> starts(count);
+    for (size_t range{}; range < count; ++range)
+        starts.at(range) = range * span;
+
+    return starts;
+}
+
+TEMPLATE
+template <typename Chain>
+bucket_stats CLASS::scan(const Chain& chain, size_t row,
+    size_t ranges) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto parallel = poolstl::execution::par;
+    const auto buckets = this->buckets();
+
+    size_t span{};
+    const auto starts = partition(span, ranges);
+    std::vector<bucket_stats> partials(starts.size());
+    std::transform(parallel, starts.cbegin(), starts.cend(), partials.begin(),
+        [&](size_t start) NOEXCEPT
+        {
+            bucket_stats out{};
+            const auto stop = std::min(start + span, buckets);
+            for (auto bucket = start; bucket < stop; ++bucket)
+            {
+                const auto value = get_cell(possible_narrow_cast<link>(bucket));
+                const auto length = chain(Link{ to_link(value) });
+                const auto bin = std::min(length, sub1(bucket_stats::bins));
+
+                // A present key is found at its list position (one cell read).
+                ++out.buckets;
+                ++out.lengths.at(bin);
+                out.rows += length;
+                out.longest = std::max(out.longest, length);
+                out.hit_bytes += length * cell_size;
+                out.hit_bytes += row * ((length * add1(length)) / two);
+                out.miss_bytes += probes * cell_size;
+
+                if (is_zero(length))
+                {
+                    ++out.empty;
+                    continue;
+                }
+
+                if constexpr (!filter_t::disabled)
+                {
+                    const uint64_t bits = to_filter(value);
+                    out.filter_bits += m;
+                    out.filter_set += std::popcount(bits);
+                }
+
+                // An absent key that passes the screen searches the full list.
+                out.probes += probes;
+                for (size_t sample{}; sample < probes; ++sample)
+                {
+                    if (screened(value, probe(bucket, sample)))
+                        out.miss_bytes += length * row;
+                    else
+                        ++out.screened;
+                }
+            }
+
+            return out;
+        });
+
+    bucket_stats total{};
+    for (const auto& partial: partials)
+        accumulate(total, partial);
+
+    return total;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+// statistics
+
+// Deterministic uniform entropy (splitmix64 finalizer), as a key thumb.
+TEMPLATE
+INLINE constexpr uint64_t CLASS::probe(size_t bucket, size_t sample) NOEXCEPT
+{
+    using namespace system;
+    uint64_t value = (bucket * probes + sample) * 0x9e3779b97f4a7c15_u64;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9_u64;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb_u64;
+    return value ^ (value >> 31);
+}
+
+TEMPLATE
+void CLASS::accumulate(bucket_stats& to, const bucket_stats& from) NOEXCEPT
+{
+    to.buckets += from.buckets;
+    to.empty += from.empty;
+    to.rows += from.rows;
+    to.longest = std::max(to.longest, from.longest);
+    for (size_t bin{}; bin < bucket_stats::bins; ++bin)
+        to.lengths.at(bin) += from.lengths.at(bin);
+
+    to.filter_set += from.filter_set;
+    to.filter_bits += from.filter_bits;
+    to.probes += from.probes;
+    to.screened += from.screened;
+    to.hit_bytes += from.hit_bytes;
+    to.miss_bytes += from.miss_bytes;
+}
+
 // protected
 // ----------------------------------------------------------------------------
 // read/write
@@ -19,8 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_IPP
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_IPP
 
-#include <atomic>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -116,6 +117,71 @@ bool CLASS::expand(const Link& count) NOEXCEPT
     return body_.expand(count);
 }
 
+// Each conflict list is read whole before any of its rows is relinked, as
+// relinking overwrites the row's next link (lists are disjoint by row). Rows
+// of a list are pushed oldest first, so equal keys (always in one list)
+// retain their newest first order. Distinct keys require no order, and
+// concurrent pushes to a common bucket are atomic.
+TEMPLATE
+bool CLASS::rehash(storage& header, const Link& buckets,
+    size_t ranges) NOEXCEPT
+{
+    using namespace system;
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    if constexpr (!keys::restorable<Key>())
+    {
+        return false;
+    }
+    else
+    {
+        head target{ header, buckets };
+        const auto ptr = get_memory();
+        if (!ptr || !target.create())
+            return false;
+
+        size_t span{};
+        std::atomic_bool fault{};
+        const auto count = body_.count();
+        const size_t limit = count.value;
+        const auto starts = head_.partition(span, ranges);
+        std::for_each(parallel, starts.cbegin(), starts.cend(),
+            [&](size_t start) NOEXCEPT
+            {
+                std::vector<Link> list{};
+                const auto stop = std::min(start + span, head_.buckets());
+                for (auto bucket = start; bucket < stop; ++bucket)
+                {
+                    list.clear();
+                    using integer = typename Link::integer;
+                    auto next = head_.top(
+                        possible_narrow_cast<integer>(bucket));
+                    while (!next.is_terminal() && (list.size() < limit))
+                    {
+                        const auto offset = ptr.offset(
+                            body::link_to_position(next));
+                        if (is_null(offset))
+                            break;
+
+                        list.push_back(next);
+                        next = unsafe_array_cast<uint8_t, Link::size>(offset);
+                    }
+
+                    for (auto it = list.rbegin(); it != list.rend(); ++it)
+                    {
+                        if (fault.load(relaxed) || !relink(target, ptr, *it))
+                        {
+                            fault.store(true, relaxed);
+                            return;
+                        }
+                    }
+                }
+            });
+
+        return !fault.load(relaxed) && target.set_body_count(count);
+    }
+}
+
 // diagnostic counters
 // ----------------------------------------------------------------------------
 
@@ -131,6 +197,21 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return negative_.load(std::memory_order_relaxed);
 }
 
+TEMPLATE
+bucket_stats CLASS::get_bucket_stats(size_t ranges) const NOEXCEPT
+{
+    const auto ptr = get_memory();
+    if (!ptr)
+        return {};
+
+    // A list longer than the body count is cyclic (integrity), so bounded.
+    const size_t limit = body_.count().value;
+    return head_.scan([&ptr, limit](const Link& top) NOEXCEPT
+    {
+        return length(ptr, top, limit);
+    }, index_size, ranges);
+}
+
 // query interface
 // ----------------------------------------------------------------------------
 
@@ -189,6 +270,94 @@ inline Link CLASS::first(const Key& key) const NOEXCEPT
     return first(get_memory(), key);
 }
 
+TEMPLATE
+void CLASS::first_many(const memory& ptr, std::span<const Key> search,
+    std::span<Link> links) const NOEXCEPT
+{
+    using namespace system;
+    BC_ASSERT(search.size() == links.size());
+    const auto count = std::min(search.size(), links.size());
+
+    for (size_t start{}; start < count; start += group)
+    {
+        const auto stop = std::min(start + group, count);
+        std::array<bool, group> done{};
+        auto active = stop - start;
+
+        // Hint all head cells of the group before reading any.
+        for (auto at = start; at < stop; ++at)
+            head_.prefetch(search[at]);
+
+        // Read (screened) tops and hint all first rows before reading any.
+        for (auto at = start; at < stop; ++at)
+        {
+            links[at] = ptr ? head_.top(search[at]) : Link{};
+            prefetch(ptr, links[at]);
+        }
+
+        // Advance each list one row per pass, hinting its next row.
+        while (is_nonzero(active))
+        {
+            for (auto at = start; at < stop; ++at)
+            {
+                if (done[at - start])
+                    continue;
+
+                auto& link = links[at];
+                if (!link.is_terminal())
+                {
+                    // get element offset (fault)
+                    const auto offset = ptr.offset(
+                        body::link_to_position(link));
+                    if (is_null(offset))
+                    {
+                        link = {};
+                    }
+
+                    // element key does not match (next)
+                    else if (!keys::compare(unsafe_array_cast<uint8_t,
+                        key_size>(std::next(offset, Link::size)), search[at]))
+                    {
+                        link = unsafe_array_cast<uint8_t, Link::size>(offset);
+                        prefetch(ptr, link);
+                        continue;
+                    }
+                }
+
+                done[at - start] = true;
+                --active;
+            }
+        }
+    }
+}
+
+TEMPLATE
+void CLASS::first_many(std::span<const Key> search,
+    std::span<Link> links) const NOEXCEPT
+{
+    first_many(get_memory(), search, links);
+}
+
+TEMPLATE
+std::vector<bool> CLASS::exists_many(const memory& ptr,
+    std::span<const Key> search) const NOEXCEPT
+{
+    std::vector<Link> links(search.size());
+    first_many(ptr, search, links);
+
+    std::vector<bool> out(links.size());
+    std::transform(links.cbegin(), links.cend(), out.begin(),
+        [](const Link& link) NOEXCEPT { return !link.is_terminal(); });
+
+    return out;
+}
+
+TEMPLATE
+std::vector<bool> CLASS::exists_many(std::span<const Key> search) const NOEXCEPT
+{
+    return exists_many(get_memory(), search);
+}
+
 TEMPLATE
 inline typename CLASS::iterator CLASS::it(Key&& key) const NOEXCEPT
 {
@@ -214,6 +383,12 @@ inline memory CLASS::get_memory() const NOEXCEPT
     return body_.get();
 }
 
+TEMPLATE
+inline bool CLASS::willneed(const Link& link) const NOEXCEPT
+{
+    return body_.willneed(link);
+}
+
 TEMPLATE
 Key CLASS::get_key(const Link& link) NOEXCEPT
 {
@@ -414,6 +589,42 @@ inline bool CLASS::put(bool& duplicate, const memory& ptr,
     return true;
 }
 
+TEMPLATE
+ELEMENT_CONSTRAINT
+bool CLASS::update(const Link& link, const Element& element) NOEXCEPT
+{
+    using namespace system;
+    static_assert(!is_slab, "in place overwrite requires records");
+    const auto ptr = get_memory();
+    if (!ptr || link.is_terminal())
+        return false;
+
+    const auto start = body::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start))
+        return false;
+
+    const auto size = ptr.size();
+    const auto position = possible_narrow_sign_cast<ptrdiff_t>(start);
+    if (position >= size)
+        return false;
+
+    const auto offset = ptr.offset(start);
+    if (is_null(offset))
+        return false;
+
+    // Rows may have been flushed, so the mutation is declared and reported
+    // (as with heads) instead of completing an allocation.
+    BC_ASSERT(is_one(element.count()));
+    body_.prepare(link, one);
+    iostream stream{ offset, size - position };
+    finalizer sink{ stream };
+    sink.skip_bytes(index_size);
+    BC_DEBUG_ONLY(sink.set_limit(RowSize);)
+    const auto result = element.to_data(sink);
+    body_.mark(link, one);
+    return result;
+}
+
 TEMPLATE
 inline Link CLASS::commit_link(const Link& link, const Key& key) NOEXCEPT
 {
@@ -443,8 +654,12 @@ bool CLASS::commit(const memory& ptr, const Link& link,
         return false;
 
     // Commit element to search index (terminal is a valid bucket index).
+    // The next link is written into the row (tracked by unstaged bodies).
     auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
-    if (!head_.push(link, next, key))
+    body_.prepare(link, one);
+    const auto pushed = head_.push(link, next, key);
+    body_.mark(link, one);
+    if (!pushed)
         return false;
 
     // set/commit is limited to record tables, one row at a time.
@@ -483,6 +698,58 @@ Link CLASS::first(const memory& ptr, const Link& link, const Key& key) NOEXCEPT
     return next;
 }
 
+// private
+TEMPLATE
+bool CLASS::relink(head& target, const memory& ptr, const Link& link) NOEXCEPT
+{
+    using namespace system;
+    const auto offset = ptr.offset(body::link_to_position(link));
+    if (is_null(offset))
+        return false;
+
+    // The row is linked to the previous top of its new bucket.
+    auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
+    const auto key = keys::read<Key>(unsafe_array_cast<uint8_t, key_size>(
+        std::next(offset, Link::size)));
+
+    // A slab link is a byte offset, so its extent is the link itself.
+    constexpr auto extent = is_slab ? Link::size : one;
+    body_.prepare(link, extent);
+    const auto pushed = target.push(link, next, key);
+    body_.mark(link, extent);
+    return pushed;
+}
+
+TEMPLATE
+inline void CLASS::prefetch(const memory& ptr, const Link& link) NOEXCEPT
+{
+    if (ptr && !link.is_terminal())
+        database::prefetch(ptr.offset(body::link_to_position(link)));
+}
+
+// static
+TEMPLATE
+size_t CLASS::length(const memory& ptr, const Link& link,
+    size_t limit) NOEXCEPT
+{
+    using namespace system;
+    size_t count{};
+    auto next = link;
+    while (!next.is_terminal() && (count < limit))
+    {
+        // get element offset (fault)
+        const auto offset = ptr.offset(body::link_to_position(next));
+        if (is_null(offset))
+            break;
+
+        // set next element link (loop)
+        next = unsafe_array_cast<uint8_t, Link::size>(offset);
+        ++count;
+    }
+
+    return count;
+}
+
 // static
 TEMPLATE
 ELEMENT_CONSTRAINT
@@ -545,6 +812,10 @@ bool CLASS::write(Link& previous, const memory& ptr, const Link& link,
     if (is_null(offset))
         return false;
 
+    // Declare the row write, a nop unless the body is unstaged (tracked).
+    const auto count = element.count();
+    body_.prepare(link, count);
+
     // iostream.flush is a nop (direct copy).
     iostream stream{ offset, size - position };
     finalizer sink{ stream };
@@ -552,21 +823,26 @@ bool CLASS::write(Link& previous, const memory& ptr, const Link& link,
     keys::write(sink, key);
 
     // Commit element to body.
-    if constexpr (!is_slab) { BC_DEBUG_ONLY(sink.set_limit(RowSize * element.count());) }
+    if constexpr (!is_slab) { BC_DEBUG_ONLY(sink.set_limit(RowSize * count);) }
     auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
     if (!element.to_data(sink))
+    {
+        body_.mark(link, count);
         return false;
+    }
 
     // Commit element to search (terminal is a valid bucket index).
     bool search{};
-    if (!head_.push(search, link, next, key))
+    const auto pushed = head_.push(search, link, next, key);
+    body_.mark(link, count);
+    if (!pushed)
         return false;
 
     // If collision set previous stack head for conflict resolution search.
     previous = search ? Link{ next } : Link{};
 
     // Report element write completion (count matches its allocation).
-    body_.complete(link, element.count());
+    body_.complete(link, count);
     return true;
 }
 
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAPS_IPP
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAPS_IPP
 
+#include <algorithm>
+#include <array>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -108,6 +110,71 @@ Link CLASS::count() const NOEXCEPT
     return body_.count();
 }
 
+// Each conflict list is read whole before any of its rows is relinked, as
+// relinking overwrites the row's next link (lists are disjoint by row). Rows
+// of a list are pushed oldest first, so equal keys (always in one list)
+// retain their newest first order. Distinct keys require no order, and
+// concurrent pushes to a common bucket are atomic.
+TEMPLATE
+bool CLASS::rehash(storage& header, const Link& buckets,
+    size_t ranges) NOEXCEPT
+{
+    using namespace system;
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    if constexpr (!keys::restorable<Key>())
+    {
+        return false;
+    }
+    else
+    {
+        head target{ header, buckets };
+        const auto ptr = get_memory();
+        if (!ptr || !target.create())
+            return false;
+
+        size_t span{};
+        std::atomic_bool fault{};
+        const auto count = body_.count();
+        const size_t limit = count.value;
+        const auto starts = head_.partition(span, ranges);
+        std::for_each(parallel, starts.cbegin(), starts.cend(),
+            [&](size_t start) NOEXCEPT
+            {
+                std::vector<Link> list{};
+                const auto stop = std::min(start + span, head_.buckets());
+                for (auto bucket = start; bucket < stop; ++bucket)
+                {
+                    list.clear();
+                    using integer = typename Link::integer;
+                    auto next = head_.top(
+                        possible_narrow_cast<integer>(bucket));
+                    while (!next.is_terminal() && (list.size() < limit))
+                    {
+                        const auto offset = ptr.offset(
+                            body::link_to_position(next));
+                        if (is_null(offset))
+                            break;
+
+                        list.push_back(next);
+                        next = unsafe_array_cast<uint8_t, Link::size>(offset);
+                    }
+
+                    for (auto it = list.rbegin(); it != list.rend(); ++it)
+                    {
+                        if (fault.load(relaxed) || !relink(target, ptr, *it))
+                        {
+                            fault.store(true, relaxed);
+                            return;
+                        }
+                    }
+                }
+            });
+
+        return !fault.load(relaxed) && target.set_body_count(count);
+    }
+}
+
 // diagnostic counters
 // ----------------------------------------------------------------------------
 
@@ -123,6 +190,21 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return negative_.load(std::memory_order_relaxed);
 }
 
+TEMPLATE
+bucket_stats CLASS::get_bucket_stats(size_t ranges) const NOEXCEPT
+{
+    const auto ptr = get_memory();
+    if (!ptr)
+        return {};
+
+    // A list longer than the body count is cyclic (integrity), so bounded.
+    const size_t limit = body_.count().value;
+    return head_.scan([&ptr, limit](const Link& top) NOEXCEPT
+    {
+        return length(ptr, top, limit);
+    }, index_size, ranges);
+}
+
 // error condition
 // ----------------------------------------------------------------------------
 
@@ -181,6 +263,94 @@ inline Link CLASS::first(const Key& key) const NOEXCEPT
     return first(get_memory(), key);
 }
 
+TEMPLATE
+void CLASS::first_many(const memory& ptr, std::span<const Key> search,
+    std::span<Link> links) const NOEXCEPT
+{
+    using namespace system;
+    BC_ASSERT(search.size() == links.size());
+    const auto count = std::min(search.size(), links.size());
+
+    for (size_t start{}; start < count; start += group)
+    {
+        const auto stop = std::min(start + group, count);
+        std::array<bool, group> done{};
+        auto active = stop - start;
+
+        // Hint all head cells of the group before reading any.
+        for (auto at = start; at < stop; ++at)
+            head_.prefetch(search[at]);
+
+        // Read (screened) tops and hint all first rows before reading any.
+        for (auto at = start; at < stop; ++at)
+        {
+            links[at] = ptr ? head_.top(search[at]) : Link{};
+            prefetch(ptr, links[at]);
+        }
+
+        // Advance each list one row per pass, hinting its next row.
+        while (is_nonzero(active))
+        {
+            for (auto at = start; at < stop; ++at)
+            {
+                if (done[at - start])
+                    continue;
+
+                auto& link = links[at];
+                if (!link.is_terminal())
+                {
+                    // get element offset (fault)
+                    const auto offset = ptr.offset(
+                        body::link_to_position(link));
+                    if (is_null(offset))
+                    {
+                        link = {};
+                    }
+
+                    // element key does not match (next)
+                    else if (!keys::compare(unsafe_array_cast<uint8_t,
+                        key_size>(std::next(offset, Link::size)), search[at]))
+                    {
+                        link = unsafe_array_cast<uint8_t, Link::size>(offset);
+                        prefetch(ptr, link);
+                        continue;
+                    }
+                }
+
+                done[at - start] = true;
+                --active;
+            }
+        }
+    }
+}
+
+TEMPLATE
+void CLASS::first_many(std::span<const Key> search,
+    std::span<Link> links) const NOEXCEPT
+{
+    first_many(get_memory(), search, links);
+}
+
+TEMPLATE
+std::vector<bool> CLASS::exists_many(const memory& ptr,
+    std::span<const Key> search) const NOEXCEPT
+{
+    std::vector<Link> links(search.size());
+    first_many(ptr, search, links);
+
+    std::vector<bool> out(links.size());
+    std::transform(links.cbegin(), links.cend(), out.begin(),
+        [](const Link& link) NOEXCEPT { return !link.is_terminal(); });
+
+    return out;
+}
+
+TEMPLATE
+std::vector<bool> CLASS::exists_many(std::span<const Key> search) const NOEXCEPT
+{
+    return exists_many(get_memory(), search);
+}
+
 TEMPLATE
 inline typename CLASS::iterator CLASS::it(Key&& key) const NOEXCEPT
 {
@@ -214,6 +384,13 @@ inline memory CLASS::get_memory() const NOEXCEPT
     return body_.template get<Column>();
 }
 
+TEMPLATE
+template <size_t Column>
+inline bool CLASS::willneed(const Link& link) const NOEXCEPT
+{
+    return body_.template willneed<Column>(link);
+}
+
 TEMPLATE
 Key CLASS::get_key(const Link& link) NOEXCEPT
 {
@@ -447,6 +624,16 @@ bool CLASS::commit(const memory& ptr, const Link& link,
     if (is_null(offset))
         return false;
 
+    // Stored key (fragment) is written before the row becomes searchable.
+    if constexpr (is_nonzero(key_size))
+    {
+        iostream stream{ std::next(offset, Link::size), key_size };
+        writer sink{ stream };
+        keys::write(sink, key);
+        if (!sink)
+            return false;
+    }
+
     // Commit element to search index (terminal is a valid bucket index).
     auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
     if (!head_.push(link, next, key))
@@ -586,6 +773,58 @@ Link CLASS::first(const memory& ptr, const Link& link, const Key& key) NOEXCEPT
     return next;
 }
 
+// private
+TEMPLATE
+bool CLASS::relink(head& target, const memory& ptr, const Link& link) NOEXCEPT
+{
+    using namespace system;
+    const auto offset = ptr.offset(body::link_to_position(link));
+    if (is_null(offset))
+        return false;
+
+    // The row is linked to the previous top of its new bucket.
+    auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
+    const auto key = keys::read<Key>(unsafe_array_cast<uint8_t, key_size>(
+        std::next(offset, Link::size)));
+
+    // A slab link is a byte offset, so its extent is the link itself.
+    constexpr auto extent = is_slab ? Link::size : one;
+    body_.prepare(link, extent);
+    const auto pushed = target.push(link, next, key);
+    body_.mark(link, extent);
+    return pushed;
+}
+
+TEMPLATE
+inline void CLASS::prefetch(const memory& ptr, const Link& link) NOEXCEPT
+{
+    if (ptr && !link.is_terminal())
+        database::prefetch(ptr.offset(body::link_to_position(link)));
+}
+
+// static
+TEMPLATE
+size_t CLASS::length(const memory& ptr, const Link& link,
+    size_t limit) NOEXCEPT
+{
+    using namespace system;
+    size_t count{};
+    auto next = link;
+    while (!next.is_terminal() && (count < limit))
+    {
+        // get element offset (fault)
+        const auto offset = ptr.offset(body::link_to_position(next));
+        if (is_null(offset))
+            break;
+
+        // set next element link (loop)
+        next = unsafe_array_cast<uint8_t, Link::size>(offset);
+        ++count;
+    }
+
+    return count;
+}
+
 // static
 TEMPLATE
 ELEMENT_CONSTRAINT
@@ -194,6 +194,53 @@ INLINE bool compare(const Array& bytes, const Key& key) NOEXCEPT
     }
 }
 
+template <class Key>
+INLINE constexpr bool restorable() NOEXCEPT
+{
+    if constexpr (is_search<Key>)
+    {
+        return is_zero(Key::offset) && (Key::width == system::hash_size);
+    }
+    else
+    {
+        return true;
+    }
+}
+
+template <class Key, class Array>
+INLINE Key read(const Array& bytes) NOEXCEPT
+{
+    using namespace system;
+    static_assert(restorable<Key>());
+    static_assert(size<Key>() <= array_count<Array>);
+    if constexpr (is_search<Key>)
+    {
+        Key key{};
+        std::copy_n(bytes.cbegin(), Key::width, key.value.begin());
+        return key;
+    }
+    else if constexpr (is_same_type<Key, chain::point>)
+    {
+        // Index is truncated to three bytes, so the null index is restored.
+        constexpr uint32_t null = 0x00ffffff;
+        const uint32_t index = bit_or<uint32_t>(bytes.at(hash_size + 0),
+            bit_or<uint32_t>(shift_left<uint32_t>(bytes.at(hash_size + 1), 8),
+                shift_left<uint32_t>(bytes.at(hash_size + 2), 16)));
+
+        return
+        {
+            array_cast<uint8_t, hash_size>(bytes),
+            index == null ? chain::point::null_index : index
+        };
+    }
+    else if constexpr (is_std_array<Key>)
+    {
+        Key key{};
+        std::copy_n(bytes.cbegin(), array_count<Key>, key.begin());
+        return key;
+    }
+}
+
 } // namespace keys
 } // namespace database
 } // namespace libbitcoin
@@ -132,6 +132,12 @@ memory CLASS::get_memory() const NOEXCEPT
     return body_.get();
 }
 
+TEMPLATE
+bool CLASS::willneed(const Link& link) const NOEXCEPT
+{
+    return body_.willneed(link);
+}
+
 // error condition
 // ----------------------------------------------------------------------------
 
@@ -297,6 +303,41 @@ bool CLASS::put(const memory& ptr, const Link& link,
     return true;
 }
 
+TEMPLATE
+template <typename Element, if_equal<Element::size, Size>>
+bool CLASS::set(const memory& ptr, const Link& link,
+    const Element& element) NOEXCEPT
+{
+    using namespace system;
+    static_assert(!is_slab, "in place overwrite requires records");
+    if (!ptr || link.is_terminal())
+        return false;
+
+    const auto start = body::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start))
+        return false;
+
+    const auto size = ptr.size();
+    const auto position = possible_narrow_sign_cast<ptrdiff_t>(start);
+    if (position >= size)
+        return false;
+
+    const auto offset = ptr.offset(start);
+    if (is_null(offset))
+        return false;
+
+    // Rows may have been flushed, so the mutation is declared and reported
+    // (as with heads) instead of completing an allocation.
+    const auto count = element.count();
+    body_.prepare(link, count);
+    iostream stream{ offset, size - position };
+    flipper sink{ stream };
+    BC_DEBUG_ONLY(sink.set_limit(Size * count);)
+    const auto result = element.to_data(sink);
+    body_.mark(link, count);
+    return result;
+}
+
 TEMPLATE
 template <typename Element, if_equal<Element::size, Size>>
 inline bool CLASS::put_link(Link& link, const Element& element) NOEXCEPT
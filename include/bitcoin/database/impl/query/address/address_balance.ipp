@@ -50,6 +50,14 @@ TEMPLATE
 code CLASS::get_confirmed_balance(const stopper& cancel, uint64_t& out,
     const hash_digest& key, bool turbo) const NOEXCEPT
 {
+    // The summary table holds the confirmed balance (no output enumeration).
+    if (summary_enabled())
+    {
+        address_summary summary{};
+        out = get_address_summary(summary, key) ? summary.balance : zero;
+        return error::success;
+    }
+
     outpoints outs{};
     if (const auto ec = get_confirmed_unspent_outpoints(cancel, outs, key,
         turbo))
@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_QUERY_ADDRESS_SUMMARY_IPP
+#define LIBBITCOIN_DATABASE_QUERY_ADDRESS_SUMMARY_IPP
+
+#include <algorithm>
+#include <map>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Address summary
+// ----------------------------------------------------------------------------
+// Confirmed aggregates, maintained by push_confirmed and pop_confirmed.
+
+// server/native
+TEMPLATE
+bool CLASS::get_address_summary(address_summary& out,
+    const hash_digest& key) const NOEXCEPT
+{
+    table::summary::record summary{};
+    if (!store_.summary.find(key, summary))
+    {
+        out = {};
+        return false;
+    }
+
+    out =
+    {
+        summary.balance,
+        summary.funded,
+        summary.spent,
+        summary.first,
+        summary.last
+    };
+
+    return true;
+}
+
+// protected
+TEMPLATE
+bool CLASS::set_summary(const header_link& link, bool positive) NOEXCEPT
+{
+    using namespace system;
+    using link_t = table::summary::link;
+    using height_t = table::summary::height;
+    using record_t = table::summary::record;
+
+    struct change
+    {
+        uint64_t credit{};
+        uint64_t debit{};
+        uint32_t funded{};
+        uint32_t spent{};
+        link_t link{};
+        record_t record{};
+    };
+
+    const auto height = get_height(link);
+    if (height.is_terminal())
+        return false;
+
+    // Aggregate the block's outputs and prevouts by script hash.
+    std::map<hash_digest, change> changes{};
+    const auto outputs = to_block_outputs(link);
+    const auto prevouts = to_block_prevouts(link);
+    if (outputs.empty())
+        return false;
+
+    {
+        const auto ptr = store_.output.get_memory();
+        table::output::get_value_script_hash output{};
+        for (const auto& out: outputs)
+        {
+            if (!store_.output.raw(ptr, out, output))
+                return false;
+
+            auto& value = changes[output.key];
+            value.credit = ceilinged_add(value.credit, output.value);
+            ++value.funded;
+        }
+
+        for (const auto& out: prevouts)
+        {
+            if (!store_.output.raw(ptr, out, output))
+                return false;
+
+            auto& value = changes[output.key];
+            value.debit = ceilinged_add(value.debit, output.value);
+            ++value.spent;
+        }
+    }
+
+    // Resolve the resulting aggregates and count new rows (no writes).
+    link_t::integer added{};
+    for (auto& [key, value]: changes)
+    {
+        auto& row = value.record;
+        value.link = store_.summary.find_link(key, row);
+        const auto empty = is_zero(row.funded) && is_zero(row.spent);
+
+        if (positive)
+        {
+            if (value.link.is_terminal())
+                ++added;
+
+            // Credits precede debits, as a block may spend its own outputs.
+            // Validation precludes overspending, so the floor is a guard only.
+            row.balance = floored_subtract(ceilinged_add(row.balance,
+                value.credit), value.debit);
+            row.funded = ceilinged_add(row.funded, value.funded);
+            row.spent = ceilinged_add(row.spent, value.spent);
+            row.first = empty ? height.value : row.first;
+            row.last = height.value;
+            continue;
+        }
+
+        // Popping the top block, so all of its activity must be summarized.
+        if (value.link.is_terminal() || (row.funded < value.funded) ||
+            (row.spent < value.spent))
+            return false;
+
+        row.balance = floored_subtract(ceilinged_add(row.balance,
+            value.debit), value.credit);
+        row.funded -= value.funded;
+        row.spent -= value.spent;
+
+        // Unless emptied, first precedes the popped top (exact), and last is
+        // recomputed from the address history that remains confirmed.
+        if (is_zero(row.funded) && is_zero(row.spent))
+        {
+            row.first = {};
+            row.last = {};
+        }
+        else
+        {
+            size_t last{};
+            if (!get_summary_last(last, key))
+                return false;
+
+            row.last = possible_narrow_cast<height_t::integer>(last);
+        }
+    }
+
+    // Preallocate all new summary records for the block (one allocation).
+    auto next = link_t{};
+    if (!is_zero(added))
+    {
+        next = store_.summary.allocate(added);
+        if (next.is_terminal())
+            return false;
+    }
+
+    for (const auto& [key, value]: changes)
+    {
+        if (value.link.is_terminal())
+        {
+            if (!store_.summary.put(next++, key, value.record))
+                return false;
+        }
+        else if (!store_.summary.update(value.link, value.record))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// protected
+TEMPLATE
+bool CLASS::get_summary_last(size_t& out, const hash_digest& key) const NOEXCEPT
+{
+    // Txs of unconfirmed blocks are not strong, so are excluded by height.
+    tx_links txs{};
+    const stopper cancel{};
+    if (get_address_txs(cancel, txs, key, max_size_t))
+        return false;
+
+    out = zero;
+    for (const auto& tx: txs)
+    {
+        const auto height = get_confirmed_height(find_strong(tx));
+        if (!height.is_terminal())
+            out = std::max<size_t>(out, height.value);
+    }
+
+    return true;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -191,6 +191,38 @@ typename CLASS::transaction::cptr CLASS::get_transaction(const tx_link& link,
     return ptr;
 }
 
+// views
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+archive_memory CLASS::get_archive_memory() const NOEXCEPT
+{
+    return
+    {
+        store_.tx.get_memory(),
+        store_.ins.get_memory(),
+        store_.ins.sequence.get_memory(),
+        store_.outs.puts.get_memory(),
+        store_.input.get_memory(),
+        store_.output.get_memory()
+    };
+}
+
+TEMPLATE
+stored_block::ptr CLASS::get_stored_block(
+    const header_link& link) const NOEXCEPT
+{
+    auto txs = to_transactions(link);
+    if (txs.empty())
+        return {};
+
+    auto memory = get_archive_memory();
+    if (!memory)
+        return {};
+
+    return std::make_shared<stored_block>(std::move(memory), std::move(txs));
+}
+
 // ins_link->point
 // ----------------------------------------------------------------------------
 
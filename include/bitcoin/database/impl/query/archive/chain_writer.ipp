@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <ranges>
 #include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -232,6 +233,113 @@ code CLASS::set_code(const tx_link& tx_fk, const transaction& tx,
     // ========================================================================
 }
 
+// set transaction (block batch)
+// ----------------------------------------------------------------------------
+// The caller holds the transactor and all table accessors, with all table rows
+// preallocated by the block writer. No allocation may occur under accessors.
+
+TEMPLATE
+code CLASS::set_code(std::vector<point>& twins, const accessors& ptrs,
+    const allocation& fks, const transaction& tx, bool bypass,
+    bool prune) NOEXCEPT
+{
+    using namespace system;
+    using ix = linkage<schema::index>;
+
+    if (tx.is_empty())
+        return error::tx_empty;
+
+    const auto& ins = *tx.inputs_ptr();
+    const auto& ous = *tx.outputs_ptr();
+    const auto inputs = possible_narrow_cast<ix::integer>(ins.size());
+    const auto outputs = possible_narrow_cast<ix::integer>(ous.size());
+
+    // Contiguously store inputs (preallocated).
+    if (!store_.input.put(ptrs.input, fks.in_fk,
+        table::input::put_ref{ {}, tx, prune }))
+        return error::tx_input_put;
+
+    // Contiguously store outputs (preallocated).
+    if (!store_.output.put(ptrs.output, fks.out_fk,
+        table::output::put_ref{ {}, fks.tx_fk, tx }))
+        return error::tx_output_put;
+
+    // Contiguously store input links (preallocated, rows shared with points).
+    // The caller's ins accessor guards raw sequence writes against remap.
+    if (!store_.ins.sequence.put(fks.ins_fk,
+        table::ins_sequence::put_ref{ {}, fks.in_fk, fks.tx_fk, tx }))
+        return error::tx_ins_put;
+
+    // Contiguously store output links (preallocated, rows shared with the
+    // address spine). The caller's outs accessor guards against remap.
+    if (!store_.outs.puts.put(fks.outs_fk,
+        table::outs::put_ref{ {}, fks.out_fk, tx }))
+        return error::tx_outs_put;
+
+    // Create tx record (preallocated).
+    // Commit is deferred for point/address index consistency.
+    if (!store_.tx.set(ptrs.tx, fks.tx_fk, tx.get_hash(false),
+        table::transaction::put_ref
+        {
+            {},
+            tx,
+            inputs,
+            outputs,
+            fks.ins_fk,
+            fks.outs_fk
+        }))
+    {
+        return error::tx_tx_set;
+    }
+
+    // Commit points (hashmap).
+    auto ins_fk = fks.ins_fk;
+    if (tx.is_coinbase())
+    {
+        // Should only be one input, but generalized anyway.
+        for (const auto& in: ins)
+            if (!store_.ins.put(ptrs.ins, ins_fk++, in->point(),
+                table::ins_point::record{}))
+                return error::tx_null_point_put;
+    }
+    else if (store_.is_dirty() || !bypass)
+    {
+        // Collect duplicates for deferred store in duplicate table.
+        for (const auto& in: ins)
+        {
+            bool duplicate{};
+            if (!store_.ins.put(duplicate, ptrs.ins, ins_fk++, in->point(),
+                table::ins_point::record{}))
+                return error::tx_point_put;
+
+            if (duplicate)
+                twins.push_back(in->point());
+        }
+    }
+    else
+    {
+        for (const auto& in: ins)
+            if (!store_.ins.put(ptrs.ins, ins_fk++, in->point(),
+                table::ins_point::record{}))
+                return error::tx_point_put;
+    }
+
+    // Commit address index records (hashmap, rows shared with outs).
+    if (address_enabled())
+    {
+        auto ad_fk = fks.outs_fk;
+        for (const auto& output: ous)
+            if (!store_.outs.commit(ptrs.outs, ad_fk++,
+                { output->script().hash() }))
+                return error::tx_address_put;
+    }
+
+    // Commit tx to search (hashmap).
+    // tx.get_hash() assumes cached or is not thread safe.
+    return store_.tx.commit(ptrs.tx, fks.tx_fk, tx.get_hash(false)) ?
+        error::success : error::tx_tx_commit;
+}
+
 // set header
 // ----------------------------------------------------------------------------
 
@@ -370,6 +478,11 @@ code CLASS::set_code(const block& block, const header_link& key,
     bool strong, bool bypass, size_t height, bool prune) NOEXCEPT
 {
     using namespace system;
+    using in_t = input_link::integer;
+    using out_t = output_link::integer;
+    using ins_t = ins_link::integer;
+    using outs_t = outs_link::integer;
+
     if (key.is_terminal())
         return error::txs_header;
 
@@ -377,37 +490,147 @@ code CLASS::set_code(const block& block, const header_link& key,
     if (is_zero(txs))
         return error::txs_empty;
 
-    const auto count = possible_narrow_cast<unsigned_type<schema::count_>>(txs);
-    const auto tx_fks = store_.tx.allocate(count);
-    if (tx_fks.is_terminal())
-        return error::tx_tx_allocate;
-
-    code ec{};
-    auto fk = tx_fks;
-    for (const auto& tx: *block.transactions_ptr())
-        if ((ec = set_code(fk++, *tx, bypass, prune)))
-            return ec;
+    // Sum full block allocation for each table, retaining tx slab sizes.
+    // Slab sizes are those written by the table put_ref elements.
+    const auto& batch = *block.transactions_ptr();
+    std::vector<size_t> input_sizes(txs);
+    std::vector<size_t> output_sizes(txs);
+    size_t points{};
+    size_t outputs{};
+    size_t input_bytes{};
+    size_t output_bytes{};
+    for (size_t index{}; index < txs; ++index)
+    {
+        const auto& tx = *batch.at(index);
+        input_sizes.at(index) = table::input::put_ref{ {}, tx, prune }.count();
+        output_sizes.at(index) = table::output::put_ref{ {}, {}, tx }.count();
+        points += tx.inputs_ptr()->size();
+        outputs += tx.outputs_ptr()->size();
+        input_bytes += input_sizes.at(index);
+        output_bytes += output_sizes.at(index);
+    }
 
     // Optional hash, only has value on height intervals.
     auto interval = create_interval(key, height);
 
-    // Depth is only set by writer for genesis (is_zero(tx_fks[0])).
+    // Depth/forks only set by writer for genesis (is_zero(tx_fks[0])).
     const auto depth = store_.interval_depth();
+    const auto forks = store_.fork_flags();
 
     using bytes = linkage<schema::size>::integer;
-    const auto light = possible_narrow_cast<bytes>(
-        block.serialized_size(false));
-    const auto heavy = possible_narrow_cast<bytes>
-        (block.serialized_size(true));
+    const auto count = possible_narrow_cast<unsigned_type<schema::count_>>(txs);
+    const auto light = possible_narrow_cast<bytes>(block.serialized_size(false));
+    const auto heavy = possible_narrow_cast<bytes>(block.serialized_size(true));
 
     // ========================================================================
     const auto scope = get_transactor();
+
+    // Allocate all block rows for each table (one allocation lock each).
+    const auto tx_fks = store_.tx.allocate(count);
+    if (tx_fks.is_terminal())
+        return error::tx_tx_allocate;
+
+    allocation fks{};
+    fks.tx_fk = tx_fks;
+
+    fks.in_fk = store_.input.allocate(
+        possible_narrow_cast<in_t>(input_bytes));
+    if (fks.in_fk.is_terminal())
+        return error::tx_input_put;
+
+    fks.out_fk = store_.output.allocate(
+        possible_narrow_cast<out_t>(output_bytes));
+    if (fks.out_fk.is_terminal())
+        return error::tx_output_put;
+
+    fks.ins_fk = store_.ins.allocate(
+        possible_narrow_cast<ins_t>(points));
+    if (fks.ins_fk.is_terminal())
+        return error::tx_ins_put;
+
+    fks.outs_fk = store_.outs.allocate(
+        possible_narrow_cast<outs_t>(outputs));
+    if (fks.outs_fk.is_terminal())
+        return error::tx_outs_put;
+
+    // Guard all tables against remap for the duration of the block write.
+    // No table may be allocated while any of these accessors are held.
+    accessors ptrs{};
+    ptrs.tx = store_.tx.get_memory();
+    ptrs.ins = store_.ins.get_memory();
+    ptrs.outs = store_.outs.get_memory();
+    ptrs.input  = store_.input.get_memory();
+    ptrs.output = store_.output.get_memory();
+
+    if (!ptrs.input ||
+        !ptrs.output ||
+        !ptrs.ins ||
+        !ptrs.outs ||
+        !ptrs.tx)
+        return error::unloaded_file;
+
+    // Offset each tx into the block allocation (prefix sums of its sizes).
+    std::vector<tx_write<transaction>> writes(txs);
+    for (size_t index{}; index < txs; ++index)
+    {
+        const auto& tx = *batch.at(index);
+        writes.at(index).tx = &tx;
+        writes.at(index).fks = fks;
+
+        fks.tx_fk++;
+        fks.ins_fk  += tx.inputs_ptr()->size();
+        fks.outs_fk += tx.outputs_ptr()->size();
+        fks.in_fk   += input_sizes.at(index);
+        fks.out_fk  += output_sizes.at(index);
+    }
+
+    // Write all txs into their disjoint preallocated rows, concurrently for
+    // large blocks. Hashmap commits are lock free, so each tx commits its own
+    // points, addresses and tx key following its row writes. Small blocks are
+    // written in order (deterministic hashmap bucket order).
+    const auto policy = poolstl::execution::par_if(txs >= parallel_writes);
+    std::for_each(policy, writes.begin(), writes.end(),
+        [&](tx_write<transaction>& write) NOEXCEPT
+        {
+            write.ec = set_code(write.twins, ptrs, write.fks, *write.tx,
+                bypass, prune);
+        });
+
+    // First failure in block order is returned (independent of concurrency).
+    std::vector<point> twins{};
+    for (const auto& write: writes)
+    {
+        if (write.ec)
+            return write.ec;
+
+        twins.insert(twins.end(), write.twins.begin(), write.twins.end());
+    }
+
+    // Release all accessors (subsequent writes allocate).
+    ptrs.tx.reset();
+    ptrs.ins.reset();
+    ptrs.outs.reset();
+    ptrs.input.reset();
+    ptrs.output.reset();
+
+    // As few duplicates are expected, duplicate domain is only 2^16.
+    // Return of tx_duplicate_put implies link domain has overflowed.
+    for (const auto& twin: twins)
+        if (!store_.duplicate.exists(twin))
+            if (!store_.duplicate.put(twin, table::duplicate::record{}))
+                return error::tx_duplicate_put;
+
     constexpr auto positive = true;
 
     // Transactor assures cannot be restored without txs, as required to unset.
     if (strong && !set_strong(key, txs, tx_fks, positive))
         return error::txs_confirm;
 
+    // Optional layout precedes txs, as txs implies block association.
+    if (layout_enabled() && !store_.layout.put(to_layout(key),
+        table::layout::put_ref{ {}, tx_fks, block }))
+        return error::txs_layout_put;
+
     // Header link is the key for the txs table.
     // Clean single allocation failure (e.g. disk full).
     return store_.txs.put(to_txs(key), table::txs::put_group
@@ -418,7 +641,8 @@ code CLASS::set_code(const block& block, const header_link& key,
         count,
         tx_fks,
         std::move(interval),
-        depth
+        depth,
+        forks
     }) ? error::success : error::txs_txs_put;
     // ========================================================================
 }
@@ -20,6 +20,8 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_WIRE_READER_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -30,7 +32,8 @@ namespace database {
 // ----------------------------------------------------------------------------
 // Due to the stoopid segwit serialization of witness after output there is are
 // duplicated navigations to store_.ins and store_.input by the witness reader.
-// This normalized approach is also the most efficient.
+// This normalized approach is also the most efficient for a streamed sink.
+// Presized buffers (below) avoid it, as stored sizes give the witness offset.
 
 TEMPLATE
 bool CLASS::get_wire_header(bytewriter& sink,
@@ -167,14 +170,16 @@ TEMPLATE
 data_chunk CLASS::get_wire_tx(const tx_link& link, bool witness) const NOEXCEPT
 {
     using namespace system;
-    size_t size{};
-    if (!get_tx_size(size, link, witness))
+    const auto memory = get_archive_memory();
+    if (!memory)
         return {};
 
-    data_chunk data(size);
-    stream::flip::fast ostream(data);
-    flip::bytes::fast out(ostream);
-    if (!get_wire_tx(out, link, witness) || !out)
+    table::transaction::record tx{};
+    if (!table::transaction::get(memory.tx, link, tx))
+        return {};
+
+    data_chunk data(witness ? tx.heavy : tx.light);
+    if (!get_wire_tx(data, memory, tx, witness))
         return {};
 
     return data;
@@ -185,19 +190,159 @@ data_chunk CLASS::get_wire_block(const header_link& link,
     bool witness) const NOEXCEPT
 {
     using namespace system;
-    size_t size{};
-    if (!get_block_size(size, link, witness))
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const auto txs = to_transactions(link);
+    if (txs.empty())
         return {};
 
+    // Remap locks are taken once here and shared (read only) by all workers.
+    const auto memory = get_archive_memory();
+    if (!memory)
+        return {};
+
+    // Stored sizes give each tx a disjoint range of the presized buffer.
+    std::vector<table::transaction::record> records(txs.size());
+    std::vector<size_t> offsets(txs.size());
+    auto size = chain::header::serialized_size() + variable_size(txs.size());
+    for (size_t position{}; position < txs.size(); ++position)
+    {
+        auto& tx = records.at(position);
+        if (!table::transaction::get(memory.tx, txs.at(position), tx))
+            return {};
+
+        offsets.at(position) = size;
+        size += (witness ? tx.heavy : tx.light);
+    }
+
     data_chunk data(size);
-    stream::flip::fast ostream(data);
+    const auto begin = data.data();
+    const data_slab prefix{ begin, std::next(begin, offsets.front()) };
+    stream::flip::fast ostream(prefix);
     flip::bytes::fast out(ostream);
-    if (!get_wire_block(out, link, witness) || !out)
+    if (!get_wire_header(out, link))
+        return {};
+
+    out.write_variable(txs.size());
+    if (!out)
+        return {};
+
+    std::vector<size_t> positions(txs.size());
+    std::iota(positions.begin(), positions.end(), zero);
+
+    stopper fault{};
+    std::for_each(parallel, positions.cbegin(), positions.cend(),
+        [&](size_t position) NOEXCEPT
+        {
+            if (fault.load(relaxed))
+                return;
+
+            const auto& tx = records.at(position);
+            const auto first = std::next(begin, offsets.at(position));
+            const auto last = std::next(first, witness ? tx.heavy : tx.light);
+            if (!get_wire_tx({ first, last }, memory, tx, witness))
+                fault.store(true, relaxed);
+        });
+
+    if (fault.load(relaxed))
         return {};
 
     return data;
 }
 
+TEMPLATE
+block_stream::ptr CLASS::get_block_stream(const header_link& link,
+    bool witness) const NOEXCEPT
+{
+    using namespace system;
+    block_stream::header_bytes header{};
+    stream::flip::fast ostream(header);
+    flip::bytes::fast out(ostream);
+    if (!get_wire_header(out, link) || !out)
+        return {};
+
+    auto txs = to_transactions(link);
+    if (txs.empty())
+        return {};
+
+    // Memory is obtained by the stream for each call, not held by it.
+    return std::make_shared<block_stream>([this]() NOEXCEPT
+    {
+        return get_archive_memory();
+    }, std::move(txs), header, witness);
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::get_wire_tx(const system::data_slab& buffer,
+    const archive_memory& memory, const table::transaction::record& tx,
+    bool witness) const NOEXCEPT
+{
+    using namespace system;
+    const auto witnessed = witness && (tx.heavy != tx.light);
+    const auto size = witnessed ? tx.heavy : tx.light;
+    if (buffer.size() != size || tx.light < two)
+        return false;
+
+    // Witnesses follow outputs, two bytes (marker and flag) past the light
+    // size less its locktime, and are followed only by the locktime.
+    const auto begin = buffer.data();
+    const auto end = std::next(begin, size);
+    const auto split = witnessed ? std::next(begin, tx.light - two) : end;
+    const data_slab body{ begin, split };
+    const data_slab tail{ split, end };
+    stream::flip::fast body_stream(body);
+    stream::flip::fast tail_stream(tail);
+    flip::bytes::fast sink(body_stream);
+    flip::bytes::fast witness_sink(tail_stream);
+
+    sink.write_4_bytes_little_endian(tx.version);
+
+    if (witnessed)
+    {
+        sink.write_byte(chain::witness_marker);
+        sink.write_byte(chain::witness_enabled);
+    }
+
+    // Point links are contiguous (computed).
+    sink.write_variable(tx.ins_count);
+    const auto ins_final = tx.point_fk + tx.ins_count;
+    for (auto fk = tx.point_fk; fk < ins_final; ++fk)
+    {
+        table::ins_point::wire_point point{ {}, sink };
+        table::ins_sequence::get_input ins{};
+        table::input::wire_input in{ {}, sink, witness_sink, witnessed };
+        if (!table::ins::get(memory.ins, fk, point) ||
+            !table::ins::get<one>(memory.sequence, fk, ins) ||
+            !table::input::raw(memory.input, ins.input_fk, in))
+            return false;
+
+        sink.write_4_bytes_little_endian(ins.sequence);
+    }
+
+    // Output fk links are contiguous (computed).
+    sink.write_variable(tx.outs_count);
+    const auto outs_final = tx.outs_fk + tx.outs_count;
+    for (auto fk = tx.outs_fk; fk < outs_final; ++fk)
+    {
+        table::outs::get_output outs{};
+        table::output::wire_output out{ {}, sink };
+        if (!table::outs::get<one>(memory.puts, fk, outs) ||
+            !table::output::raw(memory.output, outs.out_fk, out))
+            return false;
+    }
+
+    auto& last = witnessed ? witness_sink : sink;
+    last.write_4_bytes_little_endian(tx.locktime);
+
+    // Both ranges must be filled exactly, or stored sizes are inconsistent.
+    return sink && witness_sink
+        && sink.get_write_position() == body.size()
+        && witness_sink.get_write_position() == tail.size();
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_ARCHIVE_WIRE_WRITER_IPP
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_WIRE_WRITER_IPP
 
+#include <algorithm>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -294,13 +296,15 @@ code CLASS::set_code(const block_view& block, const header_link& key,
         !ptrs.tx)
         return error::unloaded_file;
 
-    // Write all txs into their preallocated rows (write order preserved).
-    code ec{};
-    std::vector<point> twins{};
-    for (const auto& tx: block.views())
+    // Offset each tx into the block allocation (prefix sums of its sizes).
+    const auto& views = block.views();
+    std::vector<tx_write<transaction_view>> writes(txs);
+    auto write = writes.begin();
+    for (const auto& tx: views)
     {
-        if ((ec = set_code(twins, ptrs, fks, tx, bypass, prune)))
-            return ec;
+        write->tx = &tx;
+        write->fks = fks;
+        ++write;
 
         // Output rows are parent fk prefixed (see table::output::put_view).
         const auto out_bytes = tx.outputs() * tx_link::size +
@@ -313,6 +317,28 @@ code CLASS::set_code(const block_view& block, const header_link& key,
         fks.out_fk  += out_bytes;
     }
 
+    BC_ASSERT(write == writes.end());
+
+    // Write all txs into their disjoint preallocated rows, concurrently for
+    // large blocks (as chain::block, each view is read by one thread only).
+    const auto policy = poolstl::execution::par_if(txs >= parallel_writes);
+    std::for_each(policy, writes.begin(), writes.end(),
+        [&](tx_write<transaction_view>& write) NOEXCEPT
+        {
+            write.ec = set_code(write.twins, ptrs, write.fks, *write.tx,
+                bypass, prune);
+        });
+
+    // First failure in block order is returned (independent of concurrency).
+    std::vector<point> twins{};
+    for (const auto& write: writes)
+    {
+        if (write.ec)
+            return write.ec;
+
+        twins.insert(twins.end(), write.twins.begin(), write.twins.end());
+    }
+
     // Release all accessors (subsequent writes allocate).
     ptrs.tx.reset();
     ptrs.ins.reset();
@@ -333,6 +359,11 @@ code CLASS::set_code(const block_view& block, const header_link& key,
     if (strong && !set_strong(key, txs, tx_fks, positive))
         return error::txs_confirm;
 
+    // Optional layout precedes txs, as txs implies block association.
+    if (layout_enabled() && !store_.layout.put(to_layout(key),
+        table::layout::put_view{ {}, tx_fks, block }))
+        return error::txs_layout_put;
+
     // Header link is the key for the txs table.
     // Clean single allocation failure (e.g. disk full).
     return store_.txs.put(to_txs(key), table::txs::put_group
@@ -19,7 +19,10 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONSENSUS_POPULATE_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONSENSUS_POPULATE_IPP
 
+#include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -38,15 +41,21 @@ TEMPLATE
 bool CLASS::populate_with_metadata(const block& block,
     bool chain) const NOEXCEPT
 {
-    const auto& txs = block.transactions_ptr();
-    if (txs->empty())
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    if (block.transactions_ptr()->empty())
         return false;
 
-    return std::all_of(std::next(txs->begin()), txs->end(),
-        [this, chain](const auto& tx) NOEXCEPT
+    const auto refs = to_prevout_refs(block);
+    std::atomic_bool missing{};
+    std::for_each(parallel, refs.begin(), refs.end(),
+        [this, chain, &missing](const prevout_ref& ref) NOEXCEPT
         {
-            return this->populate_with_metadata(*tx, chain);
+            if (!populate_with_metadata_(*ref.in, ref.tx, chain))
+                missing.store(true, relaxed);
         });
+
+    return !missing.load(relaxed);
 }
 
 TEMPLATE
@@ -87,7 +96,14 @@ bool CLASS::populate_with_metadata(const input& input,
     if (input.prevout)
         return true;
 
-    const auto tx = to_tx(input.point().hash());
+    return populate_with_metadata_(input, to_tx(input.point().hash()), chain);
+}
+
+// protected
+TEMPLATE
+bool CLASS::populate_with_metadata_(const input& input, const tx_link& tx,
+    bool chain) const NOEXCEPT
+{
     const auto index = input.point().index();
 
     // Node and chain confirmation.
@@ -147,15 +163,22 @@ bool CLASS::populate_with_metadata(const input& input,
 TEMPLATE
 bool CLASS::populate_without_metadata(const block& block) const NOEXCEPT
 {
-    const auto& txs = block.transactions_ptr();
-    if (txs->empty())
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    if (block.transactions_ptr()->empty())
         return false;
 
-    return std::all_of(std::next(txs->begin()), txs->end(),
-        [this](const auto& tx) NOEXCEPT
+    const auto refs = to_prevout_refs(block);
+    std::atomic_bool missing{};
+    std::for_each(parallel, refs.begin(), refs.end(),
+        [this, &missing](const prevout_ref& ref) NOEXCEPT
         {
-            return this->populate_without_metadata(*tx);
+            ref.in->prevout = get_output(ref.tx, ref.index);
+            if (is_null(ref.in->prevout))
+                missing.store(true, relaxed);
         });
+
+    return !missing.load(relaxed);
 }
 
 TEMPLATE
@@ -184,6 +207,106 @@ bool CLASS::populate_without_metadata(const input& input) const NOEXCEPT
     return !is_null(input.prevout);
 }
 
+// prefetch_prevouts
+// ----------------------------------------------------------------------------
+// Prevout reads are three dependent random rows (tx, outs, output), so each
+// level is advised in full before any row of the next is read. Advice is
+// asynchronous (file read-ahead), so while the caller blocks only on the
+// parent lookup the remaining page faults overlap download and validation
+// of earlier blocks. Rows already resident (or staged) are unaffected.
+
+TEMPLATE
+size_t CLASS::prefetch_prevouts(const block& block) const NOEXCEPT
+{
+    if (block.transactions_ptr()->empty())
+        return zero;
+
+    // Parent lookups compare tx row keys, so tx rows fault here.
+    const auto refs = to_prevout_refs(block);
+
+    // Advise all outs rows before reading any.
+    std::vector<outs_link> puts(refs.size());
+    std::transform(refs.begin(), refs.end(), puts.begin(),
+        [this](const prevout_ref& ref) NOEXCEPT
+        {
+            table::transaction::get_output tx{ {}, ref.index };
+            if (!store_.tx.get(ref.tx, tx))
+                return outs_link{};
+
+            store_.outs.puts.willneed(tx.outs_fk);
+            return outs_link{ tx.outs_fk };
+        });
+
+    // Advise all output rows (outs reads overlap their own read-ahead).
+    size_t advised{};
+    for (const auto& put: puts)
+    {
+        table::outs::get_output outs{};
+        if (!put.is_terminal() && store_.outs.puts.get(put, outs) &&
+            store_.output.willneed(outs.out_fk))
+            ++advised;
+    }
+
+    return advised;
+}
+
+// block prevout resolution
+// ----------------------------------------------------------------------------
+// Block population resolves all prevouts at once. Distinct parent hashes are
+// looked up in prefetched groups (overlapping head and tx body misses), and
+// prevouts are then ordered by parent tx link, which ascends with tx and
+// output body offsets. Outputs are read in parallel over contiguous ranges of
+// that order, so each thread faults pages in ascending address order.
+
+// protected
+TEMPLATE
+typename CLASS::prevout_refs CLASS::to_prevout_refs(
+    const block& block) const NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    prevout_refs refs{};
+    hashes keys{};
+
+    if (txs.size() > one)
+    {
+        for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        {
+            for (const auto& in: *(*tx)->inputs_ptr())
+            {
+                // Null point would return nullptr and be interpreted as missing.
+                BC_ASSERT(!in->point().is_null());
+                if (in->prevout)
+                    continue;
+
+                keys.push_back(in->point().hash());
+                refs.push_back({ in.get(), {}, in->point().index() });
+            }
+        }
+    }
+
+    // Spends of a common parent share its lookup.
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    const auto parents = to_txs(keys);
+
+    for (auto& ref: refs)
+    {
+        const auto key = std::lower_bound(keys.begin(), keys.end(),
+            ref.in->point().hash());
+        ref.tx = parents.at(std::distance(keys.begin(), key));
+    }
+
+    // Missing parents (terminal) sort to the end.
+    std::sort(refs.begin(), refs.end(),
+        [](const prevout_ref& left, const prevout_ref& right) NOEXCEPT
+        {
+            return left.tx == right.tx ? left.index < right.index :
+                left.tx.value < right.tx.value;
+        });
+
+    return refs;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STRONG_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STRONG_IPP
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -110,6 +113,9 @@ bool CLASS::set_strong(const header_link& link, size_t count,
     const tx_link& first_fk, bool positive) NOEXCEPT
 {
     using namespace system;
+    if (store_.dense_strong())
+        return set_strong_array(link, count, first_fk, positive);
+
     using link_t = table::strong_tx::link;
     using element_t = table::strong_tx::record;
 
@@ -130,6 +136,118 @@ bool CLASS::set_strong(const header_link& link, size_t count,
     return true;
 }
 
+// protected
+TEMPLATE
+bool CLASS::set_strong_array(const header_link& link, size_t count,
+    const tx_link& first_fk, bool positive) NOEXCEPT
+{
+    using namespace system;
+    using link_t = table::strong_array::link;
+    using element_t = table::strong_array::put_block;
+
+    // Rows are indexed by tx link and overwritten in place, so the block's
+    // contiguous tx links are written as one element (no new rows on reorg).
+    const auto records = possible_narrow_cast<link_t::integer>(count);
+    const auto end = first_fk + records;
+
+    // Expansion only grows the array, safe for concurrent blocks.
+    if (!store_.strong_array.expand(end))
+        return false;
+
+    return store_.strong_array.set(store_.strong_array.get_memory(), first_fk,
+        element_t
+        {
+            {},
+            records,
+            table::strong_array::merge(positive, link)
+        });
+}
+
+// protected
+TEMPLATE
+bool CLASS::set_strongs(const strong_blocks& blocks, bool positive) NOEXCEPT
+{
+    using namespace system;
+    using link_t = table::strong_tx::link;
+    using element_t = table::strong_tx::record;
+    using array_t = table::strong_array::put_block;
+    using array_link_t = table::strong_array::link;
+
+    // Offset each block's records into the batch (prefix sums of counts).
+    size_t records{};
+    std::vector<size_t> offsets(blocks.size());
+    for (size_t index{}; index < blocks.size(); ++index)
+    {
+        offsets.at(index) = records;
+        records += blocks.at(index).count;
+    }
+
+    stopper fail{};
+    std::vector<size_t> it(blocks.size());
+    std::iota(it.begin(), it.end(), zero);
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Rows are indexed by tx link, so one expansion covers all blocks.
+    if (store_.dense_strong())
+    {
+        array_link_t::integer end{};
+        for (const auto& block: blocks)
+            end = std::max(end, possible_narrow_cast<array_link_t::integer>(
+                block.first_fk.value + block.count));
+
+        if (!store_.strong_array.expand(end))
+            return false;
+
+        const auto ptr = store_.strong_array.get_memory();
+        std::for_each(parallel, it.cbegin(), it.cend(), [&](size_t index) NOEXCEPT
+        {
+            const auto& block = blocks.at(index);
+            if (!store_.strong_array.set(ptr, block.first_fk, array_t
+                {
+                    {},
+                    possible_narrow_cast<array_link_t::integer>(block.count),
+                    table::strong_array::merge(positive, block.link)
+                })) fail.store(true, relaxed);
+        });
+
+        return !fail.load(relaxed);
+    }
+
+    // Preallocate all strong_tx records of all blocks and share memory ptr.
+    const auto first = store_.strong_tx.allocate(
+        possible_narrow_cast<link_t::integer>(records));
+    if (first.is_terminal())
+        return false;
+
+    // Blocks have disjoint tx links and records, and commits are lock free.
+    const auto ptr = store_.strong_tx.get_memory();
+    std::for_each(parallel, it.cbegin(), it.cend(), [&](size_t index) NOEXCEPT
+    {
+        const auto& block = blocks.at(index);
+        const auto merged = table::strong_tx::merge(positive, block.link);
+        link_t record{ possible_narrow_cast<link_t::integer>(
+            first.value + offsets.at(index)) };
+
+        // Contiguous tx links.
+        const auto count = possible_narrow_cast<link_t::integer>(block.count);
+        const auto end = block.first_fk + count;
+        for (auto fk = block.first_fk; fk < end; ++fk)
+        {
+            if (fail.load(relaxed))
+                return;
+
+            if (!store_.strong_tx.put(ptr, record++, fk, element_t
+                {
+                    {},
+                    merged
+                })) fail.store(true, relaxed);
+        }
+    });
+
+    return !fail.load(relaxed);
+}
+
 TEMPLATE
 bool CLASS::set_strong(const header_link& link) NOEXCEPT
 {
@@ -90,6 +90,7 @@ size_t CLASS::store_body_size() const NOEXCEPT
         + candidate_body_size()
         + confirmed_body_size()
         + strong_tx_body_size()
+        + strong_array_body_size()
         + ecdsa_body_size()
         + schnorr_body_size()
         + silent_body_size()
@@ -99,7 +100,9 @@ size_t CLASS::store_body_size() const NOEXCEPT
         + validated_bk_body_size()
         + validated_tx_body_size()
         + filter_bk_body_size()
-        + filter_tx_body_size();
+        + filter_tx_body_size()
+        + summary_body_size()
+        + layout_body_size();
 }
 
 TEMPLATE
@@ -121,6 +124,7 @@ size_t CLASS::store_head_size() const NOEXCEPT
         + candidate_head_size()
         + confirmed_head_size()
         + strong_tx_head_size()
+        + strong_array_head_size()
         + ecdsa_head_size()
         + schnorr_head_size()
         + silent_head_size()
@@ -130,7 +134,9 @@ size_t CLASS::store_head_size() const NOEXCEPT
         + validated_bk_head_size()
         + validated_tx_head_size()
         + filter_bk_head_size()
-        + filter_tx_head_size();
+        + filter_tx_head_size()
+        + summary_head_size()
+        + layout_head_size();
 }
 
 // Sizes.
@@ -147,6 +153,7 @@ DEFINE_SIZES(tx)
 DEFINE_SIZES(candidate)
 DEFINE_SIZES(confirmed)
 DEFINE_SIZES(strong_tx)
+DEFINE_SIZES(strong_array)
 DEFINE_SIZES(ecdsa)
 DEFINE_SIZES(schnorr)
 DEFINE_SIZES(silent)
@@ -157,6 +164,8 @@ DEFINE_SIZES(validated_bk)
 DEFINE_SIZES(validated_tx)
 DEFINE_SIZES(filter_bk)
 DEFINE_SIZES(filter_tx)
+DEFINE_SIZES(summary)
+DEFINE_SIZES(layout)
 
 // Buckets (hashmap + arraymap).
 // ----------------------------------------------------------------------------
@@ -174,6 +183,8 @@ DEFINE_BUCKETS(validated_bk)
 DEFINE_BUCKETS(validated_tx)
 DEFINE_BUCKETS(filter_bk)
 DEFINE_BUCKETS(filter_tx)
+DEFINE_BUCKETS(summary)
+DEFINE_BUCKETS(layout)
 
 // Records (arrays).
 // ----------------------------------------------------------------------------
@@ -186,12 +197,14 @@ DEFINE_RECORDS(tx)
 DEFINE_RECORDS(candidate)
 DEFINE_RECORDS(confirmed)
 DEFINE_RECORDS(strong_tx)
+DEFINE_RECORDS(strong_array)
 DEFINE_RECORDS(ecdsa)
 DEFINE_RECORDS(schnorr)
 DEFINE_RECORDS(silent)
 DEFINE_RECORDS(duplicate)
 DEFINE_RECORDS(prevalid)
 DEFINE_RECORDS(filter_bk)
+DEFINE_RECORDS(summary)
 
 // Counters (archive slabs).
 // ----------------------------------------------------------------------------
@@ -264,6 +277,19 @@ bool CLASS::filter_enabled() const NOEXCEPT
     return store_.filter_bk.enabled() && store_.filter_tx.enabled();
 }
 
+TEMPLATE
+bool CLASS::summary_enabled() const NOEXCEPT
+{
+    // Popping a block recomputes summary last height from address history.
+    return store_.summary.enabled() && address_enabled();
+}
+
+TEMPLATE
+bool CLASS::layout_enabled() const NOEXCEPT
+{
+    return store_.layout.enabled();
+}
+
 } // namespace database
 } // namespace libbitcoin
 
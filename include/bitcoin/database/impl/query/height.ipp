@@ -87,6 +87,10 @@ bool CLASS::push_confirmed(const header_link& link, bool strong) NOEXCEPT
     if (strong && !set_strong(link, txs.number, txs.coinbase_fk, true))
         return false;
 
+    // Add the block to address summaries (allocation precedes writes).
+    if (summary_enabled() && !set_summary(link, true))
+        return false;
+
     return store_.confirmed.push(link);
     // ========================================================================
 }
@@ -111,6 +115,10 @@ bool CLASS::pop_confirmed() NOEXCEPT
     if (!set_strong(link, txs.number, txs.coinbase_fk, false))
         return false;
 
+    // Remove the block from address summaries (allocation free).
+    if (summary_enabled() && !set_summary(link, false))
+        return false;
+
     ///////////////////////////////////////////////////////////////////////////
     std::unique_lock interlock{ confirmed_reorganization_mutex_ };
     return store_.confirmed.truncate(top);
@@ -118,6 +126,98 @@ bool CLASS::pop_confirmed() NOEXCEPT
     // ========================================================================
 }
 
+TEMPLATE
+bool CLASS::push_confirmed_range(const header_links& links,
+    bool strong) NOEXCEPT
+{
+    using namespace system;
+    using ix = table::transaction::ix::integer;
+    if (links.empty())
+        return true;
+
+    // All reads precede the transactor, and all writes follow reservation.
+    strong_blocks blocks{};
+    blocks.reserve(links.size());
+    for (const auto& key: links)
+    {
+        const header_link link{ key };
+        if (link.is_terminal())
+            return false;
+
+        table::txs::get_coinbase_and_count txs{};
+        if (strong && !store_.txs.at(to_txs(link), txs))
+            return false;
+
+        blocks.push_back({ link, txs.coinbase_fk, txs.number });
+    }
+
+    // Reserve-push to ensure disk full safety and deferred access.
+    if (!store_.confirmed.reserve(possible_narrow_cast<ix>(links.size())))
+        return false;
+
+    // ========================================================================
+    const auto scope = get_transactor();
+
+    // This reservation guard assumes no concurrent writes to the table.
+    if (strong && !set_strongs(blocks, true))
+        return false;
+
+    // Add each block to address summaries, in confirmation order.
+    if (summary_enabled())
+        for (const auto& block: blocks)
+            if (!set_summary(block.link, true))
+                return false;
+
+    for (const auto& block: blocks)
+        if (!store_.confirmed.push(block.link))
+            return false;
+
+    return true;
+    // ========================================================================
+}
+
+TEMPLATE
+bool CLASS::pop_confirmed_to(size_t height) NOEXCEPT
+{
+    using namespace system;
+    using ix = table::transaction::ix::integer;
+    const auto top = get_top_confirmed();
+    if (height >= top)
+        return true;
+
+    // Blocks are unconfirmed from the top down, genesis is never popped.
+    strong_blocks blocks{};
+    blocks.reserve(top - height);
+    for (auto index = top; index > height; --index)
+    {
+        const auto link = to_confirmed(index);
+        table::txs::get_coinbase_and_count txs{};
+        if (!store_.txs.at(to_txs(link), txs))
+            return false;
+
+        blocks.push_back({ link, txs.coinbase_fk, txs.number });
+    }
+
+    // ========================================================================
+    const auto scope = get_transactor();
+
+    // Clean single allocation failure.
+    if (!set_strongs(blocks, false))
+        return false;
+
+    // Remove each block from address summaries (allocation free).
+    if (summary_enabled())
+        for (const auto& block: blocks)
+            if (!set_summary(block.link, false))
+                return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock interlock{ confirmed_reorganization_mutex_ };
+    return store_.confirmed.truncate(possible_narrow_cast<ix>(add1(height)));
+    ///////////////////////////////////////////////////////////////////////////
+    // ========================================================================
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -53,6 +53,14 @@ inline tx_link CLASS::to_tx(const hash_digest& key) const NOEXCEPT
     return store_.tx.first(key);
 }
 
+TEMPLATE
+tx_links CLASS::to_txs(const hashes& keys) const NOEXCEPT
+{
+    tx_links links(keys.size());
+    store_.tx.first_many(keys, links);
+    return links;
+}
+
 TEMPLATE
 inline filter_link CLASS::to_filter(const header_link& key) const NOEXCEPT
 {
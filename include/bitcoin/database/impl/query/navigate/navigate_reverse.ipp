@@ -127,8 +127,9 @@ code CLASS::to_address_outputs(const stopper& cancel, outs_link& cursor,
             break;
         }
 
-        // TODO: co-bucket rows consume the limit, so a collision with a large
-        // TODO: address truncates an unrelated small one.
+        // TODO: co-bucket rows not excluded by the stored fingerprint consume
+        // TODO: the limit, so a collision with a large address truncates an
+        // TODO: unrelated small one (always the case without a fingerprint).
         if (is_zero(limit--))
         {
             deferred = error::depth_limited;
@@ -146,6 +147,13 @@ code CLASS::to_address_outputs(const stopper& cancel, outs_link& cursor,
     if (!deferred && !found)
         deferred = error::invalid_cursor;
 
+    // A full script hash in the spine is an exact match (no verification).
+    if constexpr (schema::address::sk == schema::hash)
+    {
+        out = std::move(candidates);
+        return deferred;
+    }
+
     // Verify candidates by hashing their scripts in place.
     // Parallelizable, though marshalling may exceed the benefit even if cold.
     const auto ptr = store_.output.get_memory();
@@ -264,6 +272,16 @@ tx_links CLASS::to_duplicates(const hash_digest& tx_hash) const NOEXCEPT
 TEMPLATE
 header_link CLASS::to_block(const tx_link& link) const NOEXCEPT
 {
+    // Dense index is a single row read (unwritten rows are not positive).
+    if (store_.dense_strong())
+    {
+        table::strong_array::record row{};
+        if (!store_.strong_array.get(link, row) || !row.positive())
+            return {};
+
+        return row.header_fk();
+    }
+
     table::strong_tx::record strong{};
     if (!store_.strong_tx.find(link, strong) || !strong.positive())
         return {};
@@ -242,6 +242,14 @@ bool CLASS::get_height(size_t& out, const header_link& link) const NOEXCEPT
 TEMPLATE
 hashes CLASS::get_tx_keys(const header_link& link) const NOEXCEPT
 {
+    // The optional layout holds the block's tx hashes contiguously.
+    if (layout_enabled())
+    {
+        table::layout::get_hashes layout{};
+        if (store_.layout.at(to_layout(link), layout))
+            return std::move(layout.hashes);
+    }
+
     const auto tx_fks = to_transactions(link);
     if (tx_fks.empty())
         return {};
@@ -289,6 +297,14 @@ TEMPLATE
 tx_link CLASS::get_position_tx(const header_link& link,
     size_t position) const NOEXCEPT
 {
+    // The optional layout maps position to tx link by array indexing.
+    if (layout_enabled())
+    {
+        table::layout::get_at_position layout{ {}, position };
+        if (store_.layout.at(to_layout(link), layout))
+            return layout.tx_fk;
+    }
+
     table::txs::get_at_position txs{ {}, position };
     if (!store_.txs.at(to_txs(link), txs))
         return {};
@@ -296,6 +312,41 @@ tx_link CLASS::get_position_tx(const header_link& link,
     return txs.tx_fk;
 }
 
+// layout
+// ----------------------------------------------------------------------------
+// Offsets are from the start of the wire block (header and tx count included).
+
+TEMPLATE
+bool CLASS::get_tx_offset(size_t& offset, size_t& size,
+    const header_link& link, size_t position, bool witness) const NOEXCEPT
+{
+    if (!layout_enabled())
+        return false;
+
+    table::layout::get_offset layout{ {}, position, witness };
+    if (!store_.layout.at(to_layout(link), layout))
+        return false;
+
+    offset = layout.offset;
+    size = layout.size;
+    return true;
+}
+
+TEMPLATE
+bool CLASS::get_offset_position(size_t& out, const header_link& link,
+    size_t offset, bool witness) const NOEXCEPT
+{
+    if (!layout_enabled())
+        return false;
+
+    table::layout::get_at_offset layout{ {}, offset, witness };
+    if (!store_.layout.at(to_layout(link), layout))
+        return false;
+
+    out = layout.position;
+    return true;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -66,6 +66,17 @@ TEMPLATE
 bool CLASS::get_tx_position(size_t& out, const tx_link& link,
     const header_link& block) const NOEXCEPT
 {
+    // The optional layout maps tx link to position without a txs scan.
+    if (layout_enabled())
+    {
+        table::layout::get_position layout{ {}, link };
+        if (store_.layout.at(to_layout(block), layout))
+        {
+            out = layout.position;
+            return true;
+        }
+    }
+
     table::txs::get_position txs{ {}, link };
     if (!store_.txs.at(to_txs(block), txs))
         return false;
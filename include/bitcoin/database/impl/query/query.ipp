@@ -115,6 +115,19 @@ size_t CLASS::get_space() const NOEXCEPT
     return store_.get_space();
 }
 
+TEMPLATE
+storage_stats CLASS::get_stats() const NOEXCEPT
+{
+    return store_.get_stats();
+}
+
+TEMPLATE
+void CLASS::report_stats(
+    const typename Store::stats_handler& handler) const NOEXCEPT
+{
+    store_.report_stats(handler);
+}
+
 TEMPLATE
 code CLASS::reload(const typename Store::event_handler& handler) const NOEXCEPT
 {
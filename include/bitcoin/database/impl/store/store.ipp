@@ -61,6 +61,10 @@ CLASS::store(const settings& config) NOEXCEPT
     strong_tx_head_(head(config.path / schema::dir::heads, schema::indexes::strong_tx), head_settings(config.strong_tx), random),
     strong_tx_body_(body(config.path, schema::indexes::strong_tx), config.strong_tx, sequential, staged),
 
+    // Body unstaged and snapshot, as rows are overwritten in place (dense strong).
+    strong_array_head_(head(config.path / schema::dir::heads, schema::indexes::strong_array), head_settings(config.strong_array), sequential),
+    strong_array_body_(body(config.path, schema::indexes::strong_array), config.strong_array, random),
+
     // Caches.
     // ------------------------------------------------------------------------
 
@@ -99,6 +103,13 @@ CLASS::store(const settings& config) NOEXCEPT
     filter_tx_head_(head(config.path / schema::dir::heads, schema::optionals::filter_tx), head_settings(config.filter_tx), random),
     filter_tx_body_(body(config.path, schema::optionals::filter_tx), config.filter_tx, sequential, staged),
 
+    // Body unstaged and snapshot, as rows are overwritten in place (aggregates).
+    summary_head_(head(config.path / schema::dir::heads, schema::optionals::summary), head_settings(config.summary), random),
+    summary_body_(body(config.path, schema::optionals::summary), config.summary, random),
+
+    layout_head_(head(config.path / schema::dir::heads, schema::optionals::layout), head_settings(config.layout), random),
+    layout_body_(body(config.path, schema::optionals::layout), config.layout, sequential, staged),
+
     // Locks.
     // ------------------------------------------------------------------------
 
@@ -119,6 +130,7 @@ CLASS::store(const settings& config) NOEXCEPT
     candidate(candidate_head_),
     confirmed(confirmed_head_),
     strong_tx(strong_tx_head_, strong_tx_body_, config.strong_tx.buckets),
+    strong_array(strong_array_head_, strong_array_body_),
 
     ecdsa(ecdsa_head_, ecdsa_body_),
     schnorr(schnorr_head_, schnorr_body_),
@@ -130,7 +142,9 @@ CLASS::store(const settings& config) NOEXCEPT
     validated_tx(validated_tx_head_, validated_tx_body_, config.validated_tx.buckets),
 
     filter_bk(filter_bk_head_, filter_bk_body_, config.filter_bk.buckets),
-    filter_tx(filter_tx_head_, filter_tx_body_, config.filter_tx.buckets)
+    filter_tx(filter_tx_head_, filter_tx_body_, config.filter_tx.buckets),
+    summary(summary_head_, summary_body_, config.summary.buckets),
+    layout(layout_head_, layout_body_, config.layout.buckets)
 {
 }
 
@@ -160,6 +174,12 @@ uint32_t CLASS::fork_flags() const NOEXCEPT
     return configuration_.fork_flags;
 }
 
+TEMPLATE
+bool CLASS::dense_strong() const NOEXCEPT
+{
+    return configuration_.dense_strong;
+}
+
 TEMPLATE
 bool CLASS::is_dirty() const NOEXCEPT
 {
@@ -178,6 +198,25 @@ typename CLASS::transactor CLASS::get_transactor() NOEXCEPT
     return transactor{ transactor_mutex_ };
 }
 
+TEMPLATE
+typename CLASS::copy_progress CLASS::get_copy_progress() const NOEXCEPT
+{
+    using namespace std::chrono;
+    const auto bytes = copy_bytes_.load(std::memory_order_relaxed);
+    const auto start = copy_start_.load(std::memory_order_relaxed);
+    const auto now = duration_cast<microseconds>(
+        steady_clock::now().time_since_epoch()).count();
+    const auto elapsed = system::possible_sign_cast<uint64_t>(now - start);
+
+    return
+    {
+        .bytes = bytes,
+        .total = copy_total_.load(std::memory_order_relaxed),
+        .rate = is_zero(elapsed) ? zero : system::possible_narrow_cast<size_t>(
+            (uint64_t{ bytes } * 1'000'000u) / elapsed)
+    };
+}
+
 } // namespace database
 } // namespace libbitcoin
 
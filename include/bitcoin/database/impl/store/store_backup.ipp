@@ -53,6 +53,7 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     backup(ec, candidate, table_t::candidate_table);
     backup(ec, confirmed, table_t::confirmed_table);
     backup(ec, strong_tx, table_t::strong_tx_table);
+    backup(ec, strong_array, table_t::strong_array_table);
 
     backup(ec, ecdsa, table_t::ecdsa_table);
     backup(ec, schnorr, table_t::schnorr_table);
@@ -65,15 +66,35 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
 
     backup(ec, filter_bk, table_t::filter_bk_table);
     backup(ec, filter_tx, table_t::filter_tx_table);
+    backup(ec, summary, table_t::summary_table);
+    backup(ec, layout, table_t::layout_table);
 
     if (ec) return ec;
 
     static const auto primary = configuration_.path / schema::dir::primary;
     static const auto secondary = configuration_.path / schema::dir::secondary;
     static const auto temporary = configuration_.path / schema::dir::temporary;
+    const size_t limit = configuration_.snapshot_deltas;
 
     handler(event_t::archive_snapshot, table_t::store);
 
+    // Write head pages changed since the last snapshot as the next delta
+    // generation of /primary (replayed over its base by restore).
+    if ((deltas_ < limit) && file::is_directory(primary) && tracked())
+    {
+        // A failed generation is uncommitted (not replayed), but claimed
+        // changes are lost, so the next snapshot is full.
+        if ((ec = dump(primary, handler, add1(deltas_))))
+            deltas_ = limit;
+        else
+            ++deltas_;
+
+        return ec;
+    }
+
+    // Any failure below requires the next snapshot to be full.
+    deltas_ = limit;
+
     // Ensure existing and empty /temporary.
     if ((ec = file::clear_directory_ex(temporary))) return ec;
 
@@ -106,9 +127,10 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     if (file::is_directory(secondary))
     {
         if ((ec = file::clear_directory_ex(secondary))) return ec;
-        ec = file::remove_ex(secondary);
+        if ((ec = file::remove_ex(secondary))) return ec;
     }
 
+    deltas_ = zero;
     return ec;
 }
 
@@ -57,6 +57,7 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
     close(ec, candidate, table_t::candidate_table);
     close(ec, confirmed, table_t::confirmed_table);
     close(ec, strong_tx, table_t::strong_tx_table);
+    close(ec, strong_array, table_t::strong_array_table);
 
     close(ec, ecdsa, table_t::ecdsa_table);
     close(ec, schnorr, table_t::schnorr_table);
@@ -69,6 +70,8 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
 
     close(ec, filter_bk, table_t::filter_bk_table);
     close(ec, filter_tx, table_t::filter_tx_table);
+    close(ec, summary, table_t::summary_table);
+    close(ec, layout, table_t::layout_table);
 
     if (!ec) ec = unload_close(handler);
 
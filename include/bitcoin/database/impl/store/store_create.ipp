@@ -98,6 +98,8 @@ code CLASS::create_load(const event_handler& handler) NOEXCEPT
     create(ec, confirmed_head_, table_t::confirmed_head);
     create(ec, strong_tx_head_, table_t::strong_tx_head);
     create(ec, strong_tx_body_, table_t::strong_tx_body);
+    create(ec, strong_array_head_, table_t::strong_array_head);
+    create(ec, strong_array_body_, table_t::strong_array_body);
 
     create(ec, ecdsa_head_, table_t::ecdsa_head);
     create(ec, ecdsa_body_, table_t::ecdsa_body);
@@ -120,6 +122,10 @@ code CLASS::create_load(const event_handler& handler) NOEXCEPT
     create(ec, filter_bk_body_, table_t::filter_bk_body);
     create(ec, filter_tx_head_, table_t::filter_tx_head);
     create(ec, filter_tx_body_, table_t::filter_tx_body);
+    create(ec, summary_head_, table_t::summary_head);
+    create(ec, summary_body_, table_t::summary_body);
+    create(ec, layout_head_, table_t::layout_head);
+    create(ec, layout_body_, table_t::layout_body);
 
     const auto populate = [&handler](code& ec, auto& logical,
         table_t table) NOEXCEPT
@@ -146,6 +152,7 @@ code CLASS::create_load(const event_handler& handler) NOEXCEPT
     populate(ec, candidate, table_t::candidate_table);
     populate(ec, confirmed, table_t::confirmed_table);
     populate(ec, strong_tx, table_t::strong_tx_table);
+    populate(ec, strong_array, table_t::strong_array_table);
 
     populate(ec, ecdsa, table_t::ecdsa_table);
     populate(ec, schnorr, table_t::schnorr_table);
@@ -158,6 +165,8 @@ code CLASS::create_load(const event_handler& handler) NOEXCEPT
 
     populate(ec, filter_bk, table_t::filter_bk_table);
     populate(ec, filter_tx, table_t::filter_tx_table);
+    populate(ec, summary, table_t::summary_table);
+    populate(ec, layout, table_t::layout_table);
 
     return ec;
 }
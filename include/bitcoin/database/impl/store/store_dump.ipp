@@ -19,52 +19,150 @@
 #ifndef LIBBITCOIN_DATABASE_STORE_DUMP_IPP
 #define LIBBITCOIN_DATABASE_STORE_DUMP_IPP
 
+#include <algorithm>
+#include <chrono>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
 namespace database {
 
-// public
-// Dump memory maps of /heads to new files in /temporary.
+TEMPLATE
+const CLASS::table_map CLASS::snapshots
+{
+    { table_t::header_head, schema::archive::header },
+    { table_t::input_head, schema::archive::input },
+    { table_t::output_head, schema::archive::output },
+    { table_t::ins_head, schema::archive::ins },
+    { table_t::outs_head, schema::archive::outs },
+    { table_t::tx_head, schema::archive::tx },
+    { table_t::txs_head, schema::archive::txs },
+
+    { table_t::candidate_head, schema::indexes::candidate },
+    { table_t::confirmed_head, schema::indexes::confirmed },
+    { table_t::strong_tx_head, schema::indexes::strong_tx },
+    { table_t::strong_array_head, schema::indexes::strong_array },
+
+    { table_t::ecdsa_head, schema::caches::ecdsa },
+    { table_t::schnorr_head, schema::caches::schnorr },
+    { table_t::silent_head, schema::caches::silent },
+    { table_t::duplicate_head, schema::caches::duplicate },
+    { table_t::prevalid_head, schema::caches::prevalid },
+    { table_t::prevout_head, schema::caches::prevout },
+    { table_t::validated_bk_head, schema::caches::validated_bk },
+    { table_t::validated_tx_head, schema::caches::validated_tx },
+
+    { table_t::filter_bk_head, schema::optionals::filter_bk },
+    { table_t::filter_tx_head, schema::optionals::filter_tx },
+    { table_t::summary_head, schema::optionals::summary },
+    { table_t::layout_head, schema::optionals::layout },
+
+    // Bodies with rows rewritten in place cannot be restored by truncation.
+    { table_t::strong_array_body, std::string{ schema::indexes::strong_array } + "_body" },
+    { table_t::summary_body, std::string{ schema::optionals::summary } + "_body" }
+};
+
+TEMPLATE
+const CLASS::table_map CLASS::rewritten
+{
+    { table_t::strong_array_body, schema::indexes::strong_array },
+    { table_t::summary_body, schema::optionals::summary }
+};
+
+// protected
+TEMPLATE
+typename CLASS::table_files CLASS::heads() NOEXCEPT
+{
+    table_files out{};
+    for (const auto& item: files())
+        if (snapshots.contains(item.table))
+            out.push_back(item);
+
+    return out;
+}
+
+// protected
+TEMPLATE
+bool CLASS::tracked() NOEXCEPT
+{
+    const auto items = heads();
+    return std::all_of(items.begin(), items.end(),
+        [](const table_file& item) NOEXCEPT { return item.file.tracked(); });
+}
+
+// protected
+// Dump memory maps of /heads to new files in folder, or only their pages
+// changed since the last dump as delta generation (non-zero) files.
 // Heads are copied from RAM, not flushed to disk and copied as files.
+// Heads are independent files, so are copied concurrently (as configured).
+TEMPLATE
+code CLASS::dump(const path& folder, const event_handler& handler,
+    size_t generation) NOEXCEPT
+{
+    const auto items = heads();
+    size_t total{};
+    if (is_zero(generation))
+        for (const auto& item: items)
+            total += item.file.size();
+
+    using namespace std::chrono;
+    copy_bytes_.store(zero, std::memory_order_relaxed);
+    copy_total_.store(total, std::memory_order_relaxed);
+    copy_start_.store(duration_cast<microseconds>(
+        steady_clock::now().time_since_epoch()).count(),
+        std::memory_order_relaxed);
+
+    const auto ec = for_each_file(items, handler,
+        [&](const event_handler& notify, storage& file, table_t table) NOEXCEPT
+        {
+            const auto progress = [&](size_t bytes) NOEXCEPT
+            {
+                copy_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+                notify(event_t::copy_progress, table);
+            };
+
+            notify(event_t::copy_header, table);
+            const auto& name = snapshots.at(table);
+            return is_zero(generation) ?
+                file.dump(head(folder, name), progress) :
+                file.dump_delta(delta(folder, name, generation), progress);
+        });
+
+    // A delta generation is committed (replayable) once all heads are written.
+    if (ec || is_zero(generation))
+        return ec;
+
+    return file::create_file_ex(marker(folder, generation));
+}
+
+// protected
+// Replay committed delta generations over the base heads in folder, in
+// order, and remove all delta files (a failed generation is uncommitted).
 TEMPLATE
-code CLASS::dump(const path& folder,
-    const event_handler& handler) NOEXCEPT
+code CLASS::replay(const path& folder, const event_handler& handler) NOEXCEPT
 {
     code ec{ error::success };
-    const auto dump = [&handler, &folder](code& ec, const auto& file,
-        const auto& name, table_t table) NOEXCEPT
+    size_t generation{ one };
+    for (; file::is_file(marker(folder, generation)); ++generation)
     {
-        if (!ec)
+        for (const auto& [table, name]: snapshots)
         {
-            handler(event_t::copy_header, table);
-            ec = file.dump(head(folder, name));
+            handler(event_t::replay_delta, table);
+            if (file::apply_delta_ex(head(folder, name),
+                delta(folder, name, generation)))
+                return error::invalid_delta;
         }
-    };
-
-    dump(ec, header_head_, schema::archive::header, table_t::header_head);
-    dump(ec, input_head_, schema::archive::input, table_t::input_head);
-    dump(ec, output_head_, schema::archive::output, table_t::output_head);
-    dump(ec, ins_head_, schema::archive::ins, table_t::ins_head);
-    dump(ec, outs_head_, schema::archive::outs, table_t::outs_head);
-    dump(ec, tx_head_, schema::archive::tx, table_t::tx_head);
-    dump(ec, txs_head_, schema::archive::txs, table_t::txs_head);
-
-    dump(ec, candidate_head_, schema::indexes::candidate, table_t::candidate_head);
-    dump(ec, confirmed_head_, schema::indexes::confirmed, table_t::confirmed_head);
-    dump(ec, strong_tx_head_, schema::indexes::strong_tx, table_t::strong_tx_head);
-
-    dump(ec, ecdsa_head_, schema::caches::ecdsa, table_t::ecdsa_head);
-    dump(ec, schnorr_head_, schema::caches::schnorr, table_t::schnorr_head);
-    dump(ec, silent_head_, schema::caches::silent, table_t::silent_head);
-    dump(ec, duplicate_head_, schema::caches::duplicate, table_t::duplicate_head);
-    dump(ec, prevalid_head_, schema::caches::prevalid, table_t::prevalid_head);
-    dump(ec, prevout_head_, schema::caches::prevout, table_t::prevout_head);
-    dump(ec, validated_bk_head_, schema::caches::validated_bk, table_t::validated_bk_head);
-    dump(ec, validated_tx_head_, schema::caches::validated_tx, table_t::validated_tx_head);
-
-    dump(ec, filter_bk_head_, schema::optionals::filter_bk, table_t::filter_bk_head);
-    dump(ec, filter_tx_head_, schema::optionals::filter_tx, table_t::filter_tx_head);
+    }
+
+    // Remove committed generations and any uncommitted successor.
+    for (auto remove = generation; !is_zero(remove); --remove)
+    {
+        for (const auto& pair: snapshots)
+            if ((ec = file::remove_ex(delta(folder, pair.second, remove))))
+                return ec;
+
+        if ((ec = file::remove_ex(marker(folder, remove))))
+            return ec;
+    }
 
     return ec;
 }
@@ -39,11 +39,14 @@ const CLASS::event_map CLASS::events
     { event_t::wait_lock, "wait_lock" },
     { event_t::flush_body, "flush_body" },
     { event_t::prune_table, "prune_table" },
+    { event_t::rehash_table, "rehash_table" },
     { event_t::backup_table, "backup_table" },
     { event_t::copy_header, "copy_header" },
+    { event_t::copy_progress, "copy_progress" },
     { event_t::archive_snapshot, "archive_snapshot" },
 
     { event_t::restore_table, "restore_table" },
+    { event_t::replay_delta, "replay_delta" },
     { event_t::recover_snapshot, "recover_snapshot" }
 };
 
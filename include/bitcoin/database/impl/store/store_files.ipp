@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_STORE_FILES_IPP
+#define LIBBITCOIN_DATABASE_STORE_FILES_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// protected
+TEMPLATE
+typename CLASS::table_files CLASS::files() NOEXCEPT
+{
+    return
+    {
+        { header_head_, table_t::header_head },
+        { header_body_, table_t::header_body },
+        { input_head_, table_t::input_head },
+        { input_body_, table_t::input_body },
+        { output_head_, table_t::output_head },
+        { output_body_, table_t::output_body },
+        { ins_head_, table_t::ins_head },
+        { ins_body_, table_t::ins_body },
+        { outs_head_, table_t::outs_head },
+        { outs_body_, table_t::outs_body },
+        { tx_head_, table_t::tx_head },
+        { tx_body_, table_t::tx_body },
+        { txs_head_, table_t::txs_head },
+        { txs_body_, table_t::txs_body },
+
+        { candidate_head_, table_t::candidate_head },
+        { confirmed_head_, table_t::confirmed_head },
+        { strong_tx_head_, table_t::strong_tx_head },
+        { strong_tx_body_, table_t::strong_tx_body },
+        { strong_array_head_, table_t::strong_array_head },
+        { strong_array_body_, table_t::strong_array_body },
+
+        { ecdsa_head_, table_t::ecdsa_head },
+        { ecdsa_body_, table_t::ecdsa_body },
+        { schnorr_head_, table_t::schnorr_head },
+        { schnorr_body_, table_t::schnorr_body },
+        { silent_head_, table_t::silent_head },
+        { silent_body_, table_t::silent_body },
+        { duplicate_head_, table_t::duplicate_head },
+        { duplicate_body_, table_t::duplicate_body },
+        { prevalid_head_, table_t::prevalid_head },
+        { prevalid_body_, table_t::prevalid_body },
+        { prevout_head_, table_t::prevout_head },
+        { prevout_body_, table_t::prevout_body },
+        { validated_bk_head_, table_t::validated_bk_head },
+        { validated_bk_body_, table_t::validated_bk_body },
+        { validated_tx_head_, table_t::validated_tx_head },
+        { validated_tx_body_, table_t::validated_tx_body },
+
+        { filter_bk_head_, table_t::filter_bk_head },
+        { filter_bk_body_, table_t::filter_bk_body },
+        { filter_tx_head_, table_t::filter_tx_head },
+        { filter_tx_body_, table_t::filter_tx_body },
+        { summary_head_, table_t::summary_head },
+        { summary_body_, table_t::summary_body },
+        { layout_head_, table_t::layout_head },
+        { layout_body_, table_t::layout_body }
+    };
+}
+
+// protected
+TEMPLATE
+code CLASS::for_each_file(const table_files& items,
+    const event_handler& handler, const file_operation& operation) const NOEXCEPT
+{
+    const auto count = items.size();
+    const auto threads = std::min<size_t>(count,
+        std::max<size_t>(one, configuration_.file_concurrency));
+
+    // Files are claimed in order and no file is claimed once any has failed,
+    // so all files preceding the first failure (in file order) have been
+    // attempted. The result is therefore independent of thread scheduling.
+    std::vector<code> codes(count, error::success);
+    std::atomic<size_t> next{ zero };
+    std::atomic_bool failed{ false };
+
+    // Handler invocations are serialized, preserving the synchronous contract.
+    std::mutex mutex{};
+    const event_handler notify = [&](event_t event, table_t table) NOEXCEPT
+    {
+        std::unique_lock lock{ mutex };
+        handler(event, table);
+    };
+
+    const auto work = [&]() NOEXCEPT
+    {
+        size_t index{};
+        while (!failed.load(std::memory_order_relaxed) &&
+            ((index = next.fetch_add(one, std::memory_order_relaxed)) < count))
+        {
+            const auto& item = items.at(index);
+            if ((codes.at(index) = operation(notify, item.file, item.table)))
+                failed.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    // Files are claimed by index and the caller always works, so a thread
+    // that cannot be started only reduces concurrency (never terminates).
+    std::vector<std::thread> workers{};
+    try
+    {
+        workers.reserve(sub1(threads));
+        for (size_t thread{ one }; thread < threads; ++thread)
+            workers.emplace_back(work);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    work();
+    for (auto& worker: workers)
+        worker.join();
+
+    const auto fault = std::find_if(codes.begin(), codes.end(),
+        [](const code& ec) NOEXCEPT { return !!ec; });
+
+    return fault == codes.end() ? error::success : *fault;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
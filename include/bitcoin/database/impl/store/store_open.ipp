@@ -58,7 +58,41 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
         }
     };
 
-    auto ec = open_load(handler);
+    const auto populate = [&handler](code& ec, bool added, auto& logical,
+        table_t table) NOEXCEPT
+    {
+        if (!ec && added)
+        {
+            handler(event_t::create_table, table);
+            if (!logical.create())
+                ec = error::create_table;
+        }
+    };
+
+    // Tables added after store creation are created (empty) on first open.
+    bool strong_array_added{};
+    bool summary_added{};
+    bool layout_added{};
+    auto ec = create_added(strong_array_added, strong_array_head_,
+        strong_array_body_, table_t::strong_array_head,
+        table_t::strong_array_body, handler);
+
+    // Summaries of existing confirmed history are not backfilled, so an added
+    // summary must be disabled. An enabled summary is thereby always complete.
+    if (!ec) ec = create_added(summary_added, summary_head_, summary_body_,
+        table_t::summary_head, table_t::summary_body, handler,
+        is_zero(configuration_.summary.buckets));
+
+    // Layout may be added, as it is not required to cover all blocks.
+    if (!ec) ec = create_added(layout_added, layout_head_, layout_body_,
+        table_t::layout_head, table_t::layout_body, handler);
+
+    if (!ec) ec = verify_fingerprint();
+    if (!ec) ec = open_load(handler);
+    populate(ec, strong_array_added, strong_array,
+        table_t::strong_array_table);
+    populate(ec, summary_added, summary, table_t::summary_table);
+    populate(ec, layout_added, layout, table_t::layout_table);
 
     verify(ec, header, table_t::header_table);
     verify(ec, input, table_t::input_table);
@@ -71,6 +105,7 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     verify(ec, candidate, table_t::candidate_table);
     verify(ec, confirmed, table_t::confirmed_table);
     verify(ec, strong_tx, table_t::strong_tx_table);
+    verify(ec, strong_array, table_t::strong_array_table);
 
     verify(ec, ecdsa, table_t::ecdsa_table);
     verify(ec, schnorr, table_t::schnorr_table);
@@ -83,6 +118,14 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
 
     verify(ec, filter_bk, table_t::filter_bk_table);
     verify(ec, filter_tx, table_t::filter_tx_table);
+    verify(ec, summary, table_t::summary_table);
+    verify(ec, layout, table_t::layout_table);
+
+    // The strong index mode is not persisted, and only the selected index is
+    // written. Opening in the other mode would read all txs as unconfirmed.
+    if (!ec && !(dense_strong() ? is_zero(strong_tx.count().value) :
+        is_zero(strong_array.count().value)))
+        ec = error::strong_mode;
 
     if (ec)
     {
@@ -98,6 +141,55 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     return ec;
 }
 
+// protected
+TEMPLATE
+code CLASS::create_added(bool& added, storage& head, storage& body,
+    table_t head_table, table_t body_table, const event_handler& handler,
+    bool addable) NOEXCEPT
+{
+    // Only a table with neither file is added, otherwise open fails on it.
+    added = !file::is_file(head.file()) && !file::is_file(body.file());
+    if (!added)
+        return error::success;
+
+    // Nothing is created for a table that cannot be added as configured.
+    if (!addable)
+        return error::unbuilt_table;
+
+    handler(event_t::create_file, head_table);
+    if (const auto ec = head.create())
+        return ec;
+
+    handler(event_t::create_file, body_table);
+    return body.create();
+}
+
+TEMPLATE
+code CLASS::verify_fingerprint() const NOEXCEPT
+{
+    using spine = table::outs_address;
+    using puts = table::outs_puts;
+
+    // The address spine and puts columns share a row count, so the ratio of
+    // their (closed) file sizes persists the spine row width. A missing file
+    // is left to fail open.
+    auto column = body(configuration_.path, schema::archive::outs);
+    column.replace_extension();
+    column += "_";
+    column += std::string{ puts::suffix.data(), puts::suffix.size() };
+    column += schema::ext::data;
+
+    size_t spine_bytes{}, puts_bytes{};
+    if (!file::size(spine_bytes, outs_body_.file()) ||
+        !file::size(puts_bytes, column))
+        return error::success;
+
+    // Widths differ only in the stored fingerprint (schema::fingerprint).
+    const auto rows = puts_bytes / puts::width;
+    return spine_bytes == rows * spine::width ? error::success :
+        error::fingerprint_width;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_STORE_REHASH_IPP
+#define LIBBITCOIN_DATABASE_STORE_REHASH_IPP
+
+#include <string>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// public
+TEMPLATE
+code CLASS::rehash(const event_handler& handler) NOEXCEPT
+{
+    if (!file::is_directory(configuration_.path))
+        return error::missing_directory;
+
+    if (!transactor_mutex_.try_lock())
+        return error::transactor_lock;
+
+    if (!process_lock_.try_lock())
+    {
+        transactor_mutex_.unlock();
+        return error::process_lock;
+    }
+
+    // Requires that the store is closed cleanly (not corrupted).
+    if (!flush_lock_.try_lock())
+    {
+        /* bool */ process_lock_.try_unlock();
+        transactor_mutex_.unlock();
+        return error::flush_lock;
+    }
+
+    const auto& config = configuration_;
+    const auto primary = config.path / schema::dir::primary;
+    const auto secondary = config.path / schema::dir::secondary;
+    const auto temporary = config.path / schema::dir::temporary;
+    auto ec = file::clear_directory_ex(temporary);
+
+    // All heads are validated before any snapshot is discarded or any head is
+    // relinked, so an invalid configuration leaves the store intact.
+    bool resized{};
+    if (!ec) ec = rehash_check<table::header, schema::header::cell>(resized,
+        schema::archive::header, config.header);
+    if (!ec) ec = rehash_check<table::ins, schema::ins::cell>(resized,
+        schema::archive::ins, config.ins);
+    if (!ec) ec = rehash_check<table::outs, schema::address::cell>(resized,
+        schema::archive::outs, config.outs);
+    if (!ec) ec = rehash_check<table::transaction, schema::transaction::cell>(
+        resized, schema::archive::tx, config.tx);
+
+    if (!ec) ec = rehash_check<table::strong_tx, schema::strong_tx::cell>(
+        resized, schema::indexes::strong_tx, config.strong_tx);
+
+    if (!ec) ec = rehash_check<table::duplicate, schema::duplicate::cell>(
+        resized, schema::caches::duplicate, config.duplicate);
+    if (!ec) ec = rehash_check<table::validated_tx,
+        schema::validated_tx::cell>(resized, schema::caches::validated_tx,
+        config.validated_tx);
+
+    if (!ec) ec = rehash_check<table::summary, schema::summary::cell>(
+        resized, schema::optionals::summary, config.summary);
+
+    // Targets are created and sources verified (no writes) before any
+    // snapshot is discarded, so a failure here leaves the store intact.
+    if (!ec) ec = rehash_prepare<table::header, schema::header::cell>(
+        schema::archive::header, config.header);
+    if (!ec) ec = rehash_prepare<table::ins, schema::ins::cell,
+        table::ins_storage<Storage>>(schema::archive::ins, config.ins);
+    if (!ec) ec = rehash_prepare<table::outs, schema::address::cell,
+        table::outs_storage<Storage>>(schema::archive::outs, config.outs);
+    if (!ec) ec = rehash_prepare<table::transaction,
+        schema::transaction::cell>(schema::archive::tx, config.tx);
+
+    if (!ec) ec = rehash_prepare<table::strong_tx, schema::strong_tx::cell>(
+        schema::indexes::strong_tx, config.strong_tx);
+
+    if (!ec) ec = rehash_prepare<table::duplicate, schema::duplicate::cell>(
+        schema::caches::duplicate, config.duplicate);
+    if (!ec) ec = rehash_prepare<table::validated_tx,
+        schema::validated_tx::cell>(schema::caches::validated_tx,
+        config.validated_tx);
+
+    if (!ec) ec = rehash_prepare<table::summary, schema::summary::cell>(
+        schema::optionals::summary, config.summary);
+
+    // Rows are relinked in place, so snapshot heads do not index relinked
+    // bodies, and snapshots are discarded immediately before the first relink.
+    const auto discarded = !ec && resized;
+    if (discarded)
+    {
+        ec = file::clear_directory_ex(primary);
+        if (!ec) ec = file::remove_ex(primary);
+        if (!ec) ec = file::clear_directory_ex(secondary);
+        if (!ec) ec = file::remove_ex(secondary);
+    }
+
+    if (!ec) ec = rehash_table<table::header, schema::header::cell>(handler,
+        schema::archive::header, config.header, table_t::header_table);
+    if (!ec) ec = rehash_table<table::ins, schema::ins::cell,
+        table::ins_storage<Storage>>(handler, schema::archive::ins,
+        config.ins, table_t::ins_table);
+    if (!ec) ec = rehash_table<table::outs, schema::address::cell,
+        table::outs_storage<Storage>>(handler, schema::archive::outs,
+        config.outs, table_t::outs_table);
+    if (!ec) ec = rehash_table<table::transaction,
+        schema::transaction::cell>(handler, schema::archive::tx, config.tx,
+        table_t::tx_table);
+
+    if (!ec) ec = rehash_table<table::strong_tx, schema::strong_tx::cell>(
+        handler, schema::indexes::strong_tx, config.strong_tx,
+        table_t::strong_tx_table);
+
+    if (!ec) ec = rehash_table<table::duplicate, schema::duplicate::cell>(
+        handler, schema::caches::duplicate, config.duplicate,
+        table_t::duplicate_table);
+    if (!ec) ec = rehash_table<table::validated_tx,
+        schema::validated_tx::cell>(handler, schema::caches::validated_tx,
+        config.validated_tx, table_t::validated_tx_table);
+
+    if (!ec) ec = rehash_table<table::summary, schema::summary::cell>(
+        handler, schema::optionals::summary, config.summary,
+        table_t::summary_table);
+
+    // Relinked heads replace live heads once all have been relinked.
+    for (const auto name:
+    {
+        schema::archive::header,
+        schema::archive::ins,
+        schema::archive::outs,
+        schema::archive::tx,
+        schema::indexes::strong_tx,
+        schema::caches::duplicate,
+        schema::caches::validated_tx,
+        schema::optionals::summary
+    })
+    {
+        if (!ec) ec = rehash_commit(name);
+    }
+
+    /* bool */ file::clear_directory(temporary);
+    /* bool */ file::remove(temporary);
+
+    // unlock errors override ec.
+    // on failure after relinking flush_lock is left in place (store corrupt).
+    if ((!ec || !discarded) && !flush_lock_.try_unlock())
+        ec = error::flush_unlock;
+    if (!process_lock_.try_unlock()) ec = error::process_unlock;
+
+    // store is closed after rehash.
+    transactor_mutex_.unlock();
+    return ec;
+}
+
+// protected
+TEMPLATE
+template <size_t Cell>
+code CLASS::rehash_buckets(uint32_t& buckets,
+    const std::string& name) NOEXCEPT
+{
+    using namespace system;
+    const auto current = head(configuration_.path / schema::dir::heads, name);
+
+    // A closed head is truncated to its logical size, implying its buckets.
+    size_t size{};
+    if (const auto ec = file::size_ex(size, current))
+        return ec;
+
+    const auto cells = floored_divide(size, Cell);
+    buckets = possible_narrow_cast<uint32_t>(floored_subtract(cells, one));
+    return error::success;
+}
+
+// protected
+TEMPLATE
+template <typename Table, size_t Cell>
+code CLASS::rehash_check(bool& resized, const std::string& name,
+    const settings::bucket_table& config) NOEXCEPT
+{
+    using namespace system;
+    uint32_t buckets{};
+    if (const auto ec = rehash_buckets<Cell>(buckets, name))
+        return ec;
+
+    if (buckets == config.buckets)
+        return error::success;
+
+    // Heads are not enabled or disabled, and key fragments are not restorable.
+    if (is_zero(buckets) || is_zero(config.buckets) ||
+        !keys::restorable<typename Table::key>())
+        return error::rehash_table;
+
+    resized = true;
+    return error::success;
+}
+
+// protected
+// Preconditions are validated for all tables by rehash_check.
+TEMPLATE
+template <typename Table, size_t Cell, typename Body>
+code CLASS::rehash_prepare(const std::string& name,
+    const settings::bucket_table& config) NOEXCEPT
+{
+    const auto current = head(configuration_.path / schema::dir::heads, name);
+    const auto rebuilt = head(configuration_.path / schema::dir::temporary,
+        name);
+
+    uint32_t buckets{};
+    auto ec = rehash_buckets<Cell>(buckets, name);
+    if (ec || buckets == config.buckets)
+        return ec;
+
+    Storage<one> source{ current, head_settings(config), random };
+    Storage<one> target{ rebuilt, head_settings(config), random };
+    Body rows{ body(configuration_.path, name), config, sequential };
+
+    const auto load = [&ec](storage& file) NOEXCEPT
+    {
+        if (!ec) ec = file.open();
+        if (!ec) ec = file.load();
+    };
+
+    const auto unload = [&ec](storage& file) NOEXCEPT
+    {
+        const auto unloaded = file.unload();
+        const auto closed = file.close();
+        if (!ec) ec = unloaded ? unloaded : closed;
+    };
+
+    ec = target.create();
+    load(source);
+    load(rows);
+
+    if (!ec)
+    {
+        const Table logical{ source, rows, buckets };
+        if (!logical.verify())
+            ec = error::verify_table;
+    }
+
+    unload(rows);
+    unload(source);
+    return ec;
+}
+
+// protected
+// Preconditions are validated for all tables by rehash_check.
+TEMPLATE
+template <typename Table, size_t Cell, typename Body>
+code CLASS::rehash_table(const event_handler& handler,
+    const std::string& name, const settings::bucket_table& config,
+    table_t table) NOEXCEPT
+{
+    const auto current = head(configuration_.path / schema::dir::heads, name);
+    const auto rebuilt = head(configuration_.path / schema::dir::temporary,
+        name);
+
+    uint32_t buckets{};
+    auto ec = rehash_buckets<Cell>(buckets, name);
+    if (ec || buckets == config.buckets)
+        return ec;
+
+    handler(event_t::rehash_table, table);
+
+    // Body is unstaged, as rows are relinked in place.
+    Storage<one> source{ current, head_settings(config), random };
+    Storage<one> target{ rebuilt, head_settings(config), random };
+    Body rows{ body(configuration_.path, name), config, sequential };
+
+    const auto load = [&ec](storage& file) NOEXCEPT
+    {
+        if (!ec) ec = file.open();
+        if (!ec) ec = file.load();
+    };
+
+    const auto unload = [&ec](storage& file) NOEXCEPT
+    {
+        const auto unloaded = file.unload();
+        const auto closed = file.close();
+        if (!ec) ec = unloaded ? unloaded : closed;
+    };
+
+    // Target was created and source verified by rehash_prepare.
+    load(source);
+    load(target);
+    load(rows);
+
+    if (!ec)
+    {
+        Table logical{ source, rows, buckets };
+        if (!logical.rehash(target, config.buckets))
+            ec = error::rehash_table;
+    }
+
+    unload(rows);
+    unload(target);
+    unload(source);
+    return ec;
+}
+
+// protected
+TEMPLATE
+code CLASS::rehash_commit(const std::string& name) NOEXCEPT
+{
+    const auto current = head(configuration_.path / schema::dir::heads, name);
+    const auto rebuilt = head(configuration_.path / schema::dir::temporary,
+        name);
+
+    // Only resized heads are rebuilt, and replacement of a head is atomic.
+    if (!file::is_file(rebuilt))
+        return error::success;
+
+    return file::rename_ex(rebuilt, current);
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
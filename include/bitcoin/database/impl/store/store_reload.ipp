@@ -72,6 +72,8 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, confirmed_head_, table_t::confirmed_head);
     reload(ec, strong_tx_head_, table_t::strong_tx_head);
     reload(ec, strong_tx_body_, table_t::strong_tx_body);
+    reload(ec, strong_array_head_, table_t::strong_array_head);
+    reload(ec, strong_array_body_, table_t::strong_array_body);
 
     reload(ec, ecdsa_head_, table_t::ecdsa_head);
     reload(ec, ecdsa_body_, table_t::ecdsa_body);
@@ -94,6 +96,10 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, filter_bk_body_, table_t::filter_bk_body);
     reload(ec, filter_tx_head_, table_t::filter_tx_head);
     reload(ec, filter_tx_body_, table_t::filter_tx_body);
+    reload(ec, summary_head_, table_t::summary_head);
+    reload(ec, summary_body_, table_t::summary_body);
+    reload(ec, layout_head_, table_t::layout_head);
+    reload(ec, layout_body_, table_t::layout_body);
 
     transactor_mutex_.unlock();
     return ec;
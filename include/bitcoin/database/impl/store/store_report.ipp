@@ -49,6 +49,7 @@ void CLASS::report(const error_handler& handler) const NOEXCEPT
     report(tx_body_, table_t::tx_body);
     report(txs_body_, table_t::txs_body);
     report(strong_tx_body_, table_t::strong_tx_body);
+    report(strong_array_body_, table_t::strong_array_body);
     report(ecdsa_body_, table_t::ecdsa_body);
     report(schnorr_body_, table_t::schnorr_body);
     report(silent_body_, table_t::silent_body);
@@ -59,6 +60,63 @@ void CLASS::report(const error_handler& handler) const NOEXCEPT
     report(validated_tx_body_, table_t::validated_tx_body);
     report(filter_bk_body_, table_t::filter_bk_body);
     report(filter_tx_body_, table_t::filter_tx_body);
+    report(summary_body_, table_t::summary_body);
+    report(layout_body_, table_t::layout_body);
+}
+
+// public
+TEMPLATE
+void CLASS::report_stats(const stats_handler& handler) const NOEXCEPT
+{
+    const auto report = [&handler](const auto& file, table_t table) NOEXCEPT
+    {
+        handler(file.stats(), table);
+    };
+
+    report(header_head_, table_t::header_head);
+    report(header_body_, table_t::header_body);
+    report(input_head_, table_t::input_head);
+    report(input_body_, table_t::input_body);
+    report(output_head_, table_t::output_head);
+    report(output_body_, table_t::output_body);
+    report(ins_head_, table_t::ins_head);
+    report(ins_body_, table_t::ins_body);
+    report(outs_head_, table_t::outs_head);
+    report(outs_body_, table_t::outs_body);
+    report(tx_head_, table_t::tx_head);
+    report(tx_body_, table_t::tx_body);
+    report(txs_head_, table_t::txs_head);
+    report(txs_body_, table_t::txs_body);
+    report(candidate_head_, table_t::candidate_head);
+    report(confirmed_head_, table_t::confirmed_head);
+    report(strong_tx_head_, table_t::strong_tx_head);
+    report(strong_tx_body_, table_t::strong_tx_body);
+    report(strong_array_head_, table_t::strong_array_head);
+    report(strong_array_body_, table_t::strong_array_body);
+    report(ecdsa_head_, table_t::ecdsa_head);
+    report(ecdsa_body_, table_t::ecdsa_body);
+    report(schnorr_head_, table_t::schnorr_head);
+    report(schnorr_body_, table_t::schnorr_body);
+    report(silent_head_, table_t::silent_head);
+    report(silent_body_, table_t::silent_body);
+    report(duplicate_head_, table_t::duplicate_head);
+    report(duplicate_body_, table_t::duplicate_body);
+    report(prevalid_head_, table_t::prevalid_head);
+    report(prevalid_body_, table_t::prevalid_body);
+    report(prevout_head_, table_t::prevout_head);
+    report(prevout_body_, table_t::prevout_body);
+    report(validated_bk_head_, table_t::validated_bk_head);
+    report(validated_bk_body_, table_t::validated_bk_body);
+    report(validated_tx_head_, table_t::validated_tx_head);
+    report(validated_tx_body_, table_t::validated_tx_body);
+    report(filter_bk_head_, table_t::filter_bk_head);
+    report(filter_bk_body_, table_t::filter_bk_body);
+    report(filter_tx_head_, table_t::filter_tx_head);
+    report(filter_tx_body_, table_t::filter_tx_body);
+    report(summary_head_, table_t::summary_head);
+    report(summary_body_, table_t::summary_body);
+    report(layout_head_, table_t::layout_head);
+    report(layout_body_, table_t::layout_body);
 }
 
 // public
@@ -84,6 +142,8 @@ code CLASS::get_fault() const NOEXCEPT
     if ((ec = confirmed_head_.get_fault())) return ec;
     if ((ec = strong_tx_head_.get_fault())) return ec;
     if ((ec = strong_tx_body_.get_fault())) return ec;
+    if ((ec = strong_array_head_.get_fault())) return ec;
+    if ((ec = strong_array_body_.get_fault())) return ec;
     if ((ec = ecdsa_head_.get_fault())) return ec;
     if ((ec = ecdsa_body_.get_fault())) return ec;
     if ((ec = schnorr_head_.get_fault())) return ec;
@@ -104,6 +164,10 @@ code CLASS::get_fault() const NOEXCEPT
     if ((ec = filter_bk_body_.get_fault())) return ec;
     if ((ec = filter_tx_head_.get_fault())) return ec;
     if ((ec = filter_tx_body_.get_fault())) return ec;
+    if ((ec = summary_head_.get_fault())) return ec;
+    if ((ec = summary_body_.get_fault())) return ec;
+    if ((ec = layout_head_.get_fault())) return ec;
+    if ((ec = layout_body_.get_fault())) return ec;
     return ec;
 }
 
@@ -135,6 +199,8 @@ size_t CLASS::get_space() const NOEXCEPT
     space(confirmed_head_);
     space(strong_tx_head_);
     space(strong_tx_body_);
+    space(strong_array_head_);
+    space(strong_array_body_);
     space(ecdsa_head_);
     space(ecdsa_body_);
     space(schnorr_head_);
@@ -155,6 +221,45 @@ size_t CLASS::get_space() const NOEXCEPT
     space(filter_bk_body_);
     space(filter_tx_head_);
     space(filter_tx_body_);
+    space(summary_head_);
+    space(summary_body_);
+    space(layout_head_);
+    space(layout_body_);
+
+    return total;
+}
+
+// public
+TEMPLATE
+storage_stats CLASS::get_stats() const NOEXCEPT
+{
+    storage_stats total{};
+    report_stats([&total](const storage_stats& stats, table_t) NOEXCEPT
+    {
+        using namespace system;
+        total.logical = ceilinged_add(total.logical, stats.logical);
+        total.frontier = ceilinged_add(total.frontier, stats.frontier);
+        total.settled = ceilinged_add(total.settled, stats.settled);
+        total.lag = ceilinged_add(total.lag, stats.lag);
+        total.debt = ceilinged_add(total.debt, stats.debt);
+        total.window = ceilinged_add(total.window, stats.window);
+        total.remaps = ceilinged_add(total.remaps, stats.remaps);
+        total.settle_bytes = ceilinged_add(total.settle_bytes,
+            stats.settle_bytes);
+        total.evict_bytes = ceilinged_add(total.evict_bytes,
+            stats.evict_bytes);
+        total.throttle_waits = ceilinged_add(total.throttle_waits,
+            stats.throttle_waits);
+        total.ring_spins = ceilinged_add(total.ring_spins, stats.ring_spins);
+        total.released_pages = ceilinged_add(total.released_pages,
+            stats.released_pages);
+        total.restored_pages = ceilinged_add(total.restored_pages,
+            stats.restored_pages);
+        total.faults = ceilinged_add(total.faults, stats.faults);
+        for (size_t bin{}; bin < storage_stats::flush_bins; ++bin)
+            total.flush_durations.at(bin) = ceilinged_add(
+                total.flush_durations.at(bin), stats.flush_durations.at(bin));
+    });
 
     return total;
 }
@@ -63,6 +63,7 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         ec = file::clear_directory_ex(heads);
         if (!ec) ec = file::remove_ex(heads);
         if (!ec) ec = file::rename_ex(primary, heads);
+        if (!ec) ec = replay(heads, handler);
         if (!ec) ec = file::copy_directory_ex(heads, primary);
         if (!ec) ec = file::discharge_directory_ex(primary);
     }
@@ -72,6 +73,7 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         ec = file::clear_directory_ex(heads);
         if (!ec) ec = file::remove_ex(heads);
         if (!ec) ec = file::rename_ex(secondary, heads);
+        if (!ec) ec = replay(heads, handler);
         if (!ec) ec = file::copy_directory_ex(heads, primary);
         if (!ec) ec = file::discharge_directory_ex(primary);
     }
@@ -94,6 +96,16 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         return ec;
     }
 
+    // Bodies rewritten in place are replaced by their snapshot (not reverted
+    // by truncation to the restored head counts).
+    for (const auto& [table, name]: rewritten)
+    {
+        if (ec) break;
+        const auto file = body(configuration_.path, name);
+        ec = file::remove_ex(file);
+        if (!ec) ec = file::copy_ex(head(heads, snapshots.at(table)), file);
+    }
+
     // Height index (headmap) content is captured/restored with the heads.
     const auto restore = [&handler](code& ec, auto& logical,
         table_t table) NOEXCEPT
@@ -133,6 +145,7 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         restore(ec, candidate, table_t::candidate_table);
         restore(ec, confirmed, table_t::confirmed_table);
         restore(ec, strong_tx, table_t::strong_tx_table);
+        restore(ec, strong_array, table_t::strong_array_table);
 
         // ecdsa, schnorr, and prevalid are dropped.
         //---------------------------------------------------------------------
@@ -154,6 +167,8 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
 
         restore(ec, filter_bk, table_t::filter_bk_table);
         restore(ec, filter_tx, table_t::filter_tx_table);
+        restore(ec, summary, table_t::summary_table);
+        restore(ec, layout, table_t::layout_table);
 
         if (ec)
             /* code */ unload_close(handler);
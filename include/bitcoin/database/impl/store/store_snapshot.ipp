@@ -34,38 +34,46 @@ code CLASS::snapshot(const event_handler& handler, bool prune) NOEXCEPT
         handler(event_t::wait_lock, table_t::store);
     }
 
-    code ec{ error::success };
-    const auto flush = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    // Assumes/requires tables open/loaded.
+    table_files bodies
     {
-        if (!ec)
-        {
-            handler(event_t::flush_body, table);
-            ec = file.flush();
-        }
-    };
+        { header_body_, table_t::header_body },
+        { input_body_, table_t::input_body },
+        { output_body_, table_t::output_body },
+        { ins_body_, table_t::ins_body },
+        { outs_body_, table_t::outs_body },
+        { tx_body_, table_t::tx_body },
+        { txs_body_, table_t::txs_body },
 
-    // Assumes/requires tables open/loaded.
-    flush(ec, header_body_, table_t::header_body);
-    flush(ec, input_body_, table_t::input_body);
-    flush(ec, output_body_, table_t::output_body);
-    flush(ec, ins_body_, table_t::ins_body);
-    flush(ec, outs_body_, table_t::outs_body);
-    flush(ec, tx_body_, table_t::tx_body);
-    flush(ec, txs_body_, table_t::txs_body);
+        { strong_tx_body_, table_t::strong_tx_body },
+        { strong_array_body_, table_t::strong_array_body },
 
-    flush(ec, strong_tx_body_, table_t::strong_tx_body);
+        { ecdsa_body_, table_t::ecdsa_body },
+        { schnorr_body_, table_t::schnorr_body },
+        { silent_body_, table_t::silent_body },
+        { duplicate_body_, table_t::duplicate_body },
+        { prevalid_body_, table_t::prevalid_body },
+        { validated_bk_body_, table_t::validated_bk_body },
+        { validated_tx_body_, table_t::validated_tx_body },
 
-    flush(ec, ecdsa_body_, table_t::ecdsa_body);
-    flush(ec, schnorr_body_, table_t::schnorr_body);
-    flush(ec, silent_body_, table_t::silent_body);
-    flush(ec, duplicate_body_, table_t::duplicate_body);
-    flush(ec, prevalid_body_, table_t::prevalid_body);
-    if (!prune) flush(ec, prevout_body_, table_t::prevout_body);
-    flush(ec, validated_bk_body_, table_t::validated_bk_body);
-    flush(ec, validated_tx_body_, table_t::validated_tx_body);
+        { filter_bk_body_, table_t::filter_bk_body },
+        { filter_tx_body_, table_t::filter_tx_body },
+        { summary_body_, table_t::summary_body },
+        { layout_body_, table_t::layout_body }
+    };
+
+    if (!prune)
+        bodies.push_back({ prevout_body_, table_t::prevout_body });
 
-    flush(ec, filter_bk_body_, table_t::filter_bk_body);
-    flush(ec, filter_tx_body_, table_t::filter_tx_body);
+    // Bodies are independent files, so are flushed concurrently (as
+    // configured), and the flush point blocks for the slowest sync rather
+    // than for the sum of them.
+    auto ec = for_each_file(bodies, handler,
+        [](const event_handler& notify, storage& file, table_t table) NOEXCEPT
+        {
+            notify(event_t::flush_body, table);
+            return file.flush();
+        });
 
     if (!ec) ec = backup(handler, prune);
     if (!prune) transactor_mutex_.unlock();
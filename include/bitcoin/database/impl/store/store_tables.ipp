@@ -60,6 +60,9 @@ const CLASS::table_map CLASS::tables
     { table_t::strong_tx_table, "strong_tx_table" },
     { table_t::strong_tx_head, "strong_tx_head" },
     { table_t::strong_tx_body, "strong_tx_body" },
+    { table_t::strong_array_table, "strong_array_table" },
+    { table_t::strong_array_head, "strong_array_head" },
+    { table_t::strong_array_body, "strong_array_body" },
 
     // Caches.
     { table_t::ecdsa_table, "ecdsa_table" },
@@ -96,7 +99,13 @@ const CLASS::table_map CLASS::tables
     { table_t::filter_bk_body, "filter_bk_body" },
     { table_t::filter_tx_table, "filter_tx_table" },
     { table_t::filter_tx_head, "filter_tx_head" },
-    { table_t::filter_tx_body, "filter_tx_body" }
+    { table_t::filter_tx_body, "filter_tx_body" },
+    { table_t::summary_table, "summary_table" },
+    { table_t::summary_head, "summary_head" },
+    { table_t::summary_body, "summary_body" },
+    { table_t::layout_table, "layout_table" },
+    { table_t::layout_head, "layout_head" },
+    { table_t::layout_body, "layout_body" }
 };
 
 } // namespace database
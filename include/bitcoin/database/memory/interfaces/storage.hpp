@@ -19,13 +19,68 @@
 #ifndef LIBBITCOIN_DATABASE_MEMORY_INTERFACES_STORAGE_HPP
 #define LIBBITCOIN_DATABASE_MEMORY_INTERFACES_STORAGE_HPP
 
+#include <array>
 #include <filesystem>
+#include <functional>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/accessor.hpp>
 
 namespace libbitcoin {
 namespace database {
 
+/// Runtime statistics of a storage instance, sampled lock-free (each field is
+/// individually current, the set is not an atomic snapshot). Rows are bytes
+/// for slabs. Counters accumulate from construction (rates by differencing).
+struct storage_stats
+{
+    static constexpr size_t flush_bins = 16;
+
+    /// Rows allocated (logical size).
+    size_t logical{};
+
+    /// Rows below which all writes are complete.
+    size_t frontier{};
+
+    /// Rows converted to the read-only file mapping (staged only).
+    size_t settled{};
+
+    /// Rows of incomplete writes (logical - frontier), a pinned frontier
+    /// stops settling while debt grows.
+    size_t lag{};
+
+    /// Rows pending settlement (logical - settled), the throttle pressure.
+    size_t debt{};
+
+    /// Extents outstanding in the write completion ring.
+    size_t window{};
+
+    /// Map reservation replacements (growth).
+    size_t remaps{};
+
+    /// Bytes written and converted to the file mapping.
+    size_t settle_bytes{};
+
+    /// Bytes of settled rows released from cache.
+    size_t evict_bytes{};
+
+    /// Allocations parked by the staging memory bound.
+    size_t throttle_waits{};
+
+    /// Allocation yields on a full completion ring.
+    size_t ring_spins{};
+
+    /// Head pages released to the file mapping, and restored on write.
+    size_t released_pages{};
+    size_t restored_pages{};
+
+    /// Fault conditions raised (the first is retained as the fault code).
+    size_t faults{};
+
+    /// Completed flushes by duration, bin zero under one millisecond and bin
+    /// n (non-zero) under 2^n milliseconds (last bin is open).
+    std::array<size_t, flush_bins> flush_durations{};
+};
+
 /// Mapped memory interface.
 /// A slab has a row width of 1, so "count" implies "bytes" for slabs below.
 class storage
@@ -33,6 +88,7 @@ class storage
 public:
     static constexpr auto eof = system::bit_all<size_t>;
     using path = std::filesystem::path;
+    using progress = std::function<void(size_t bytes)>;
 
     /// Get the fault condition.
     virtual code get_fault() const NOEXCEPT = 0;
@@ -70,6 +126,13 @@ public:
     {
     }
 
+    /// Advise that size bytes at offset of column will be read soon, so
+    /// that the read does not fault (asynchronous, false where unsupported).
+    virtual bool willneed(size_t, size_t, size_t=zero) const NOEXCEPT
+    {
+        return false;
+    }
+
     /// Flush memory map to disk, suspend writes for call, must be loaded.
     virtual code flush() NOEXCEPT = 0;
 
@@ -82,6 +145,29 @@ public:
     /// Dump current logical map to a new file in path, must not exist.
     virtual code dump(const path& path) const NOEXCEPT = 0;
 
+    /// Dump as above, streamed in chunks with bytes of each sent to handler.
+    virtual code dump(const path& path,
+        const progress& handler) const NOEXCEPT = 0;
+
+    /// True if pages changed since the last dump are tracked (from a dump).
+    virtual bool tracked() const NOEXCEPT
+    {
+        return false;
+    }
+
+    /// Dump pages changed since the last dump to a new delta file in path,
+    /// with bytes of each span sent to handler, must be tracked.
+    virtual code dump_delta(const path&, const progress&) const NOEXCEPT
+    {
+        return error::untracked_file;
+    }
+
+    /// Runtime statistics (all zero where unsupported).
+    virtual storage_stats stats() const NOEXCEPT
+    {
+        return {};
+    }
+
     /// Current of rows/bytes in map (zero if closed).
     virtual size_t size() const NOEXCEPT = 0;
 
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_MEMORY_MMAP_HPP
 #define LIBBITCOIN_DATABASE_MEMORY_MMAP_HPP
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <filesystem>
 #include <memory>
@@ -126,6 +128,11 @@ public:
     /// instances under the staging backend only; no effect otherwise).
     void mark(size_t offset, size_t size) NOEXCEPT override;
 
+    /// Advise size bytes at offset of column will be read soon (file page
+    /// read-ahead, no effect on resident pages), false if not advised.
+    bool willneed(size_t offset, size_t size,
+        size_t column=zero) const NOEXCEPT override;
+
     /// Flush memory map(s) to disk, suspend writes for call, must be loaded.
     code flush() NOEXCEPT override;
 
@@ -138,6 +145,19 @@ public:
     /// Dump current logical map to a new file in path, must not exist.
     code dump(const path& path) const NOEXCEPT override;
 
+    /// Dump as above, streamed in chunks with bytes of each sent to handler.
+    code dump(const path& path,
+        const progress& handler) const NOEXCEPT override;
+
+    /// True if pages changed since the last dump are tracked (from a dump,
+    /// unstaged instances under the staging backend only).
+    bool tracked() const NOEXCEPT override;
+
+    /// Dump pages changed since the last dump to a new delta file in path,
+    /// with bytes of each span sent to handler, must be tracked.
+    code dump_delta(const path& path,
+        const progress& handler) const NOEXCEPT override;
+
     /// The current count of rows/bytes in map (zero if closed).
     size_t size() const NOEXCEPT override;
 
@@ -166,6 +186,9 @@ public:
     /// Rows/bytes below which all writes are complete (size() when quiescent).
     size_t frontier() const NOEXCEPT override;
 
+    /// Runtime statistics, lock-free (staging values zero where unstaged).
+    storage_stats stats() const NOEXCEPT override;
+
     /// Remap-protected r/w access to offset (or null) allocated to size.
     memory get_filled(size_t offset, size_t size,
         uint8_t backfill) NOEXCEPT override;
@@ -219,6 +242,8 @@ private:
     static constexpr size_t settle_chunk = system::power2(28u);
     static constexpr size_t advise_chunk = system::power2(30u);
     static constexpr size_t commit_chunk = system::power2(28u);
+    static constexpr size_t dump_chunk = system::power2(26u);
+    static constexpr size_t io_depth = 8;
     static constexpr size_t chunk_scale = 256;
     static constexpr size_t evict_chunk = system::power2(30u);
     static constexpr size_t compress_factor = 32;
@@ -268,9 +293,6 @@ private:
     // to release) and the dirty bitmap (nothing to transfer).
     static constexpr bool head_shared = false;
     static constexpr size_t headroom = 4;
-#if defined(STAGING_TELEMETRY)
-    static constexpr size_t telemetry_seconds = 60;
-#endif
     static constexpr auto fail = -1;
     static constexpr auto relaxed = std::memory_order_relaxed;
     static constexpr auto release = std::memory_order_release;
@@ -289,6 +311,9 @@ private:
     bool grow_(size_t end) NOEXCEPT;
     bool probe_(size_t capacity) NOEXCEPT;
 
+    // flush duration histogram, thread safe (relaxed).
+    void timed_(const std::chrono::steady_clock::time_point& start) NOEXCEPT;
+
     // mman wrappers, not thread safe.
     template <size_t Column>
     bool flush_(size_t rows) NOEXCEPT;
@@ -347,6 +372,9 @@ private:
     bool sync_() NOEXCEPT;
     void remark_(size_t offset, size_t size) NOEXCEPT;
 
+    // snapshot change tracking (unstaged instances), under shared remap.
+    file::spans take_changes_(size_t bytes) const NOEXCEPT;
+
     // head page release (unstaged instances), synchronized with writers by
     // the prepare/release bit protocol (see release_pages_).
     bool release_pages_() NOEXCEPT;
@@ -363,6 +391,7 @@ private:
     bool settle_write_(size_t from, size_t to,
         std::index_sequence<Index...>) NOEXCEPT;
     bool advise_(uint8_t* map, size_t size) const NOEXCEPT;
+    void* reserve_(size_t size) const NOEXCEPT;
     size_t to_reservation(size_t rows) const NOEXCEPT;
     size_t page_floor(size_t bytes) const NOEXCEPT;
     size_t page_ceiling(size_t bytes) const NOEXCEPT;
@@ -395,6 +424,8 @@ private:
     const advice access_;
     const bool random_;
     const bool staged_;
+    const bool huge_;
+    const bool interleave_;
 
     // These are thread safe (atomic).
     std::atomic<error::error_t> error_{ error::success };
@@ -405,6 +436,11 @@ private:
     std::atomic_bool fault_{};
     std::atomic_bool loaded_{};
 
+    // These are thread safe (atomic statistics counters, relaxed).
+    std::atomic<size_t> remaps_{};
+    std::atomic<size_t> faults_{};
+    std::array<std::atomic<size_t>, storage_stats::flush_bins> flushes_{};
+
     // This is protected by field_mutex_.
     std::array<int, columns> opened_;
     mutable std::shared_mutex field_mutex_{};
@@ -455,19 +491,31 @@ private:
     // This is unshared (settler thread only).
     size_t evicted_{};
 
-#if defined(STAGING_TELEMETRY)
-    // This is unshared (settler thread only).
-    size_t telemetry_{};
-#endif
-
     // These are thread safe (atomic).
     std::atomic<size_t> marks_{};
     std::atomic<size_t> settled_{};
     std::atomic<size_t> frontier_{};
     std::atomic<uint64_t> window_{};
 
+    // File rows at the last full (metadata) sync of each column.
+    std::array<std::atomic<size_t>, columns> synced_{};
+
+    // These are thread safe (atomic statistics counters, relaxed).
+    std::atomic<size_t> settle_bytes_{};
+    std::atomic<size_t> evict_bytes_{};
+    std::atomic<size_t> throttle_waits_{};
+    std::atomic<size_t> ring_spins_{};
+    std::atomic<size_t> pages_released_{};
+    std::atomic<size_t> pages_restored_{};
+
+    // Page-changed bitmap since the last dump (snapshot deltas). Marked with
+    // dirty_ but cleared only by dump, and valid only once tracking is set by
+    // a dump (reinstalled bitmaps start clean against an unknown snapshot).
+    mutable std::atomic_bool tracking_{};
+
     // These are protected by remap_mutex_.
     std::unique_ptr<dirty_bitmaps> dirty_{};
+    std::unique_ptr<dirty_bitmaps> changed_{};
     std::unique_ptr<dirty_bitmaps> intent_{};
     std::unique_ptr<dirty_bitmaps> released_{};
     size_t words_{};
@@ -494,8 +542,11 @@ private:
     // claimed pages remain unwritten (a stale snapshot copy).
     mutable std::mutex transfer_mutex_{};
 
-    // These are protected by extent_mutex_.
+    // These are protected by extent_mutex_. The granule is the page unit of
+    // mapping conversion (settle, release, commit), the huge page when huge
+    // pages are configured and available, otherwise the page.
     size_t page_{};
+    size_t granule_{};
     std::array<extent, extents> ring_{};
     std::array<size_t, columns> reserved_{};
     mutable std::mutex extent_mutex_{};
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_DATABASE_MEMORY_MSTAGE_HPP
 #define LIBBITCOIN_DATABASE_MEMORY_MSTAGE_HPP
 
+#include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 // The native windows mapped-file behavior is the model staging emulates.
@@ -39,6 +41,17 @@
 /// Reserve inaccessible anonymous address space (MAP_FAILED on failure).
 void* mmap_reserve(size_t size) NOEXCEPT;
 
+/// As above, with the base aligned to align (a power of two page multiple).
+void* mmap_reserve(size_t size, size_t align) NOEXCEPT;
+
+/// Advise transparent huge pages over the range (reserved or committed),
+/// -1 where unsupported (the range then remains backed by base pages).
+int mmap_huge(void* address, size_t size) NOEXCEPT;
+
+/// Interleave future page placement over the range across online NUMA nodes,
+/// zero if one node (nothing to interleave), -1 where unsupported.
+int mmap_interleave(void* address, size_t size) NOEXCEPT;
+
 /// Release reserved address space (with any mappings installed within it).
 int mmap_unreserve(void* address, size_t size) NOEXCEPT;
 
@@ -79,6 +92,25 @@ bool pread_all(int fd, uint8_t* to, size_t size, size_t offset) NOEXCEPT;
 bool pwrite_all(int fd, const uint8_t* from, size_t size,
     size_t offset) NOEXCEPT;
 
+/// As above, issued as up to depth concurrent stripes (device queue depth).
+/// Stripes are independent, so a failed write may leave others written.
+/// Lanes are persistent dedicated threads, and a failure to start one fails
+/// the transfer (no request is issued).
+bool pread_all(int fd, uint8_t* to, size_t size, size_t offset,
+    size_t depth) NOEXCEPT;
+bool pwrite_all(int fd, const uint8_t* from, size_t size, size_t offset,
+    size_t depth) NOEXCEPT;
+
+/// Write the (offset, size) runs of base at their offsets, issued as up to
+/// depth concurrent requests. Returns false with runs reduced to the failed.
+bool pwrite_runs(int fd, const uint8_t* base,
+    std::vector<std::pair<size_t, size_t>>& runs, size_t depth) NOEXCEPT;
+
+/// Split size bytes into up to depth (offset, size) stripes, none smaller than
+/// the stripe minimum (4MiB) unless the transfer is, empty if size is zero.
+std::vector<std::pair<size_t, size_t>> to_stripes(size_t size,
+    size_t depth) NOEXCEPT;
+
 #endif // MANAGE_STAGING
 
 #endif
@@ -73,6 +73,18 @@ struct storage_settings
     /// KB/t to 4.0 (one page per fault), bandwidth to ~250 MB/s, and the
     /// validation rate from 648 to 720 blk/min at the same heights.
     advice access{ advice::scattered };
+
+    /// Back anonymous head and staging memory with transparent huge pages,
+    /// converting (settle, release) at huge page granularity. Heads probe at
+    /// random over far more memory than the TLB spans, so base pages make
+    /// each lookup a page walk. Falls back to base pages where unavailable.
+    bool huge{ false };
+
+    /// Interleave anonymous head pages across NUMA nodes (heads only). A head
+    /// is otherwise placed on the node that first touched it during load, so
+    /// probes from every other node pay a cross-socket miss. No effect on a
+    /// single node or where the platform provides no memory policy.
+    bool interleave{ false };
 };
 
 } // namespace database
@@ -24,12 +24,20 @@
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
+#if defined(HAVE_MSC) && defined(HAVE_X64)
+    #include <xmmintrin.h>
+#endif
+
 namespace libbitcoin {
 namespace database {
 
 /// The byte size of system pages, zero if failed.
 BCD_API size_t page_size() NOEXCEPT;
 
+/// The byte size of transparent huge pages, zero if failed, disabled by the
+/// system, or the platform provides no source.
+BCD_API size_t huge_page_size() NOEXCEPT;
+
 /// The bytes of physical memory, zero if failed.
 BCD_API uint64_t system_memory() NOEXCEPT;
 
@@ -134,6 +142,19 @@ inline std::pair<size_t, size_t> bit_run(const uint64_t* words, size_t pages,
     return { start, end };
 }
 
+/// Hint that the cache line at address is about to be read (never faults).
+/// This hides cache latency only, a non-resident page still faults on read.
+inline void prefetch(const void* address) NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    #if defined(HAVE_X64)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+    #endif
+#else
+    __builtin_prefetch(address, 0, 3);
+#endif
+}
+
 /// C++26: std::atomic<size_t>::fetch_max
 template <typename Integral, if_integral_integer<Integral> = true>
 Integral fetch_max(std::atomic<Integral>& atomic, Integral value) NOEXCEPT
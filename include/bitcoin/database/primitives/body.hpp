@@ -53,6 +53,10 @@ public:
     template <size_t Column = zero>
     inline memory::iterator get_raw(const Link& link) const NOEXCEPT;
 
+    /// Advise the column record (slab start) at link will be read soon.
+    template <size_t Column = zero>
+    inline bool willneed(const Link& link) const NOEXCEPT;
+
     /// Return memory object (limited to AoS) within capacity.
     template <size_t Columns = sizeof...(Sizes), if_equal<Columns, one> = true>
     inline memory get_capacity(const Link& link) const NOEXCEPT;
@@ -86,6 +90,11 @@ public:
     /// Report element write completion of count records at link.
     void complete(const Link& link, const Link& count) NOEXCEPT;
 
+    /// Declare (before) and report (after) in-place mutation of count records
+    /// at link, for unstaged storage (no effect otherwise).
+    void prepare(const Link& link, const Link& count) NOEXCEPT;
+    void mark(const Link& link, const Link& count) NOEXCEPT;
+
     /// Get the unified fault condition.
     code get_fault() const NOEXCEPT;
 
@@ -42,6 +42,11 @@ public:
         return table_.template get_memory<Column>();
     }
 
+    INLINE bool willneed(const link& record) const NOEXCEPT
+    {
+        return table_.template willneed<Column>(record);
+    }
+
     template <typename Element>
     INLINE bool get(const link& record, Element& element) const NOEXCEPT
     {
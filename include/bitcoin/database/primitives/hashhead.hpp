@@ -20,16 +20,53 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HEAD_HPP
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <shared_mutex>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/memory/utilities.hpp>
 #include <bitcoin/database/primitives/keys.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 
 namespace libbitcoin {
 namespace database {
 
+/// Bucket occupancy and conflict list statistics of a hash table scan.
+/// Averages are derived by the reader (e.g. hit_bytes / rows), and bytes are
+/// those of head cells and body link/key prefixes read by first().
+struct bucket_stats
+{
+    static constexpr size_t bins = 16;
+
+    /// Buckets scanned, and those with an empty conflict list.
+    size_t buckets{};
+    size_t empty{};
+
+    /// Rows reachable from buckets (sum of conflict list lengths).
+    size_t rows{};
+
+    /// Longest conflict list, and buckets by list length (last bin is open).
+    size_t longest{};
+    std::array<size_t, bins> lengths{};
+
+    /// Filter bits set, of those available, in occupied bucket cells.
+    size_t filter_set{};
+    size_t filter_bits{};
+
+    /// Synthetic absent key probes of occupied buckets, and those screened
+    /// (rejected by the cell filter without a conflict list search).
+    size_t probes{};
+    size_t screened{};
+
+    /// Bytes read by first() summed over each row's key (as if unique).
+    size_t hit_bytes{};
+
+    /// Bytes read by first() summed over buckets x probes absent keys.
+    size_t miss_bytes{};
+};
+
 /// Fixed size hashmap header.
 template <class Link, class Key, size_t CellSize = Link::size,
     if_not_greater<Link::size, CellSize> = true>
@@ -70,11 +107,27 @@ public:
     /// Unsafe if verify false.
     inline Link top(const Key& key) const NOEXCEPT;
     inline Link top(const Link& index) const NOEXCEPT;
+
+    /// Hint the bucket cell of key into cache ahead of top(key).
+    inline void prefetch(const Key& key) const NOEXCEPT;
     inline bool push(const Link& current, bytes& next, const Key& key) NOEXCEPT;
     inline bool push(bool& collision, const Link& current, bytes& next,
         const Key& key) NOEXCEPT;
 
+    /// First bucket of each of up to ranges contiguous ranges of span.
+    std::vector<size_t> partition(size_t& span, size_t ranges) const NOEXCEPT;
+
+    /// Scan all buckets in parallel over ranges (unsafe if verify false).
+    /// chain(top) is thread safe and returns the conflict list length from
+    /// top, and row is the bytes first() reads from each list element.
+    template <typename Chain>
+    bucket_stats scan(const Chain& chain, size_t row,
+        size_t ranges) const NOEXCEPT;
+
 protected:
+    /// Synthetic absent keys probed against each occupied bucket filter.
+    static constexpr size_t probes = 8;
+
 
     // filtering
     // ------------------------------------------------------------------------
@@ -101,6 +154,11 @@ protected:
     INLINE static constexpr cell next_cell(bool& collision, cell previous,
         link current, uint64_t entropy) NOEXCEPT;
 
+    INLINE static constexpr uint64_t probe(size_t bucket,
+        size_t sample) NOEXCEPT;
+    static void accumulate(bucket_stats& to,
+        const bucket_stats& from) NOEXCEPT;
+
     inline cell get_cell(const Link& index) const NOEXCEPT;
     inline bool set_cell(bool& collision, bytes& next, const Link& current,
         const Key& key) NOEXCEPT;
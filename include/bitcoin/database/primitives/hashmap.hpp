@@ -20,6 +20,8 @@
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_HPP
 
 #include <atomic>
+#include <span>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
 #include <bitcoin/database/primitives/hashhead.hpp>
@@ -81,6 +83,13 @@ public:
     /// Increase count as necessary to specified.
     bool expand(const Link& count) NOEXCEPT;
 
+    /// Relink all indexed rows into an empty head of buckets on header, in
+    /// parallel over ranges of current buckets (not thread safe). Row links
+    /// are rewritten in place (body must be unstaged), so the new head must
+    /// replace the current (restorable keys only).
+    bool rehash(storage& header, const Link& buckets,
+        size_t ranges=64) NOEXCEPT;
+
     /// Diagnostic counters.
     /// -----------------------------------------------------------------------
 
@@ -90,6 +99,10 @@ public:
     /// Count of puts not resulting in table body search to detect duplication.
     size_t negative_search_count() const NOEXCEPT;
 
+    /// Scan bucket occupancy, conflict list lengths and filter screening,
+    /// in parallel over bucket ranges (holds shared lock on body remap).
+    bucket_stats get_bucket_stats(size_t ranges=64) const NOEXCEPT;
+
     /// Errors.
     /// -----------------------------------------------------------------------
 
@@ -116,6 +129,19 @@ public:
     inline Link first(const memory& ptr, const Key& key) const NOEXCEPT;
     inline Link first(const Key& key) const NOEXCEPT;
 
+    /// Batched first(), links[n] is first of keys[n] or terminal (sizes must
+    /// match). Head cells and list rows of each group of keys are prefetched
+    /// and the lists advanced interleaved, overlapping their cache misses.
+    void first_many(const memory& ptr, std::span<const Key> keys,
+        std::span<Link> links) const NOEXCEPT;
+    void first_many(std::span<const Key> keys,
+        std::span<Link> links) const NOEXCEPT;
+
+    /// Batched exists(), in order of keys.
+    std::vector<bool> exists_many(const memory& ptr,
+        std::span<const Key> keys) const NOEXCEPT;
+    std::vector<bool> exists_many(std::span<const Key> keys) const NOEXCEPT;
+
     /// Iterator holds shared lock on storage remap.
     inline iterator it(Key&& key) const NOEXCEPT;
     inline iterator it(const Key& key) const NOEXCEPT;
@@ -126,6 +152,9 @@ public:
     /// Return ptr for batch processing, holds shared lock on storage remap.
     inline memory get_memory() const NOEXCEPT;
 
+    /// Advise the record (slab start) at link will be read soon (asynchronous).
+    inline bool willneed(const Link& link) const NOEXCEPT;
+
     /// Return the associated search key (terminal link returns default).
     Key get_key(const Link& link) NOEXCEPT;
 
@@ -198,6 +227,10 @@ public:
     inline bool put(bool& duplicate, const memory& ptr, const Link& link,
         const Key& key, const Element& element) NOEXCEPT;
 
+    /// Overwrite element of committed link in place (index is unchanged).
+    template <typename Element, if_equal<Element::size, RowSize> = true>
+    bool update(const Link& link, const Element& element) NOEXCEPT;
+
     /// Commit previously set element at link to key.
     inline Link commit_link(const Link& link, const Key& key) NOEXCEPT;
     inline bool commit(const Link& link, const Key& key) NOEXCEPT;
@@ -209,6 +242,11 @@ protected:
     static Link first(const memory& ptr, const Link& link,
         const Key& key) NOEXCEPT;
 
+    /// memory parameter must be from start (i.e. from get_memory()).
+    /// Count conflict list elements from top link, up to limit.
+    static size_t length(const memory& ptr, const Link& link,
+        size_t limit) NOEXCEPT;
+
     /// memory parameter must be from start (i.e. from get_memory()).
     /// Get element at link using memory object, false if deserialize error.
     template <typename Element, if_equal<Element::size, RowSize> = true>
@@ -228,9 +266,18 @@ private:
     static constexpr auto is_slab = (RowSize == max_size_t);
     static constexpr auto key_size = keys::size<Key>();
     static constexpr auto index_size = Link::size + key_size;
+    static constexpr size_t group = 16;
     using head = database::hashhead<Link, Key, CellSize>;
     using body = database::body<Link, Key, RowSize>;
 
+    // memory parameter must be from start (i.e. from get_memory()).
+    // Push the (unstaged) row at link to target by its stored key.
+    bool relink(head& target, const memory& ptr, const Link& link) NOEXCEPT;
+
+    // memory parameter must be from start (i.e. from get_memory()).
+    // Hint the row at link into cache (terminal is ignored).
+    static inline void prefetch(const memory& ptr, const Link& link) NOEXCEPT;
+
     // Thread safe (index/top/push).
     // Not thread safe (create/open/close/backup/restore).
     head head_;
@@ -76,6 +76,15 @@ INLINE void write(writer& sink, const Key& key) NOEXCEPT;
 template <class Array, class Key>
 INLINE bool compare(const Array& bytes, const Key& key) NOEXCEPT;
 
+/// True if the key is recoverable from its size() stored bytes (not a search
+/// key fragment), as required to rebuild an index from its body.
+template <class Key>
+INLINE constexpr bool restorable() NOEXCEPT;
+
+/// Read key from size() bytes (key must be restorable).
+template <class Key, class Array>
+INLINE Key read(const Array& bytes) NOEXCEPT;
+
 } // namespace keys
 } // namespace database
 } // namespace libbitcoin
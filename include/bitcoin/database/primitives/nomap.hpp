@@ -85,6 +85,9 @@ public:
     /// Return ptr for batch processing, holds shared lock on storage remap.
     memory get_memory() const NOEXCEPT;
 
+    /// Advise the record (slab start) at link will be read soon (asynchronous).
+    bool willneed(const Link& link) const NOEXCEPT;
+
     /// Errors.
     /// -----------------------------------------------------------------------
 
@@ -129,6 +132,12 @@ public:
     bool put(const memory& ptr, const Link& link,
         const Element& element) NOEXCEPT;
 
+    /// Overwrite previously written element at link in place, using
+    /// get_memory() ptr (requires unstaged storage).
+    template <typename Element, if_equal<Element::size, Size> = true>
+    bool set(const memory& ptr, const Link& link,
+        const Element& element) NOEXCEPT;
+
     /// Put element and return link.
     template <typename Element, if_equal<Element::size, Size> = true>
     bool put_link(Link& link, const Element& element) NOEXCEPT;
@@ -88,6 +88,13 @@ public:
     /// Get the space required to clear the disk full condition.
     size_t get_space() const NOEXCEPT;
 
+    /// Get runtime storage statistics summed across all table files.
+    storage_stats get_stats() const NOEXCEPT;
+
+    /// Dump runtime storage statistics of each table file to handler.
+    void report_stats(
+        const typename Store::stats_handler& handler) const NOEXCEPT;
+
     /// Resume from disk full condition.
     code reload(const typename Store::event_handler& handler) const NOEXCEPT;
 
@@ -131,6 +138,7 @@ public:
     size_t candidate_head_size() const NOEXCEPT;
     size_t confirmed_head_size() const NOEXCEPT;
     size_t strong_tx_head_size() const NOEXCEPT;
+    size_t strong_array_head_size() const NOEXCEPT;
     size_t ecdsa_head_size() const NOEXCEPT;
     size_t schnorr_head_size() const NOEXCEPT;
     size_t silent_head_size() const NOEXCEPT;
@@ -141,6 +149,8 @@ public:
     size_t validated_tx_head_size() const NOEXCEPT;
     size_t filter_bk_head_size() const NOEXCEPT;
     size_t filter_tx_head_size() const NOEXCEPT;
+    size_t summary_head_size() const NOEXCEPT;
+    size_t layout_head_size() const NOEXCEPT;
 
     /// Table body logical byte sizes.
     size_t header_body_size() const NOEXCEPT;
@@ -154,6 +164,7 @@ public:
     size_t candidate_body_size() const NOEXCEPT;
     size_t confirmed_body_size() const NOEXCEPT;
     size_t strong_tx_body_size() const NOEXCEPT;
+    size_t strong_array_body_size() const NOEXCEPT;
     size_t ecdsa_body_size() const NOEXCEPT;
     size_t schnorr_body_size() const NOEXCEPT;
     size_t silent_body_size() const NOEXCEPT;
@@ -164,6 +175,8 @@ public:
     size_t validated_tx_body_size() const NOEXCEPT;
     size_t filter_bk_body_size() const NOEXCEPT;
     size_t filter_tx_body_size() const NOEXCEPT;
+    size_t summary_body_size() const NOEXCEPT;
+    size_t layout_body_size() const NOEXCEPT;
 
     /// Table (head + body) logical byte sizes.
     size_t header_size() const NOEXCEPT;
@@ -177,6 +190,7 @@ public:
     size_t candidate_size() const NOEXCEPT;
     size_t confirmed_size() const NOEXCEPT;
     size_t strong_tx_size() const NOEXCEPT;
+    size_t strong_array_size() const NOEXCEPT;
     size_t ecdsa_size() const NOEXCEPT;
     size_t schnorr_size() const NOEXCEPT;
     size_t silent_size() const NOEXCEPT;
@@ -187,6 +201,8 @@ public:
     size_t validated_tx_size() const NOEXCEPT;
     size_t filter_bk_size() const NOEXCEPT;
     size_t filter_tx_size() const NOEXCEPT;
+    size_t summary_size() const NOEXCEPT;
+    size_t layout_size() const NOEXCEPT;
 
     /// Buckets (hashmap + arraymap).
     size_t header_buckets() const NOEXCEPT;
@@ -202,6 +218,8 @@ public:
     size_t validated_tx_buckets() const NOEXCEPT;
     size_t filter_bk_buckets() const NOEXCEPT;
     size_t filter_tx_buckets() const NOEXCEPT;
+    size_t summary_buckets() const NOEXCEPT;
+    size_t layout_buckets() const NOEXCEPT;
 
     /// Records.
     size_t header_records() const NOEXCEPT;
@@ -212,12 +230,14 @@ public:
     size_t candidate_records() const NOEXCEPT;
     size_t confirmed_records() const NOEXCEPT;
     size_t strong_tx_records() const NOEXCEPT;
+    size_t strong_array_records() const NOEXCEPT;
     size_t ecdsa_records() const NOEXCEPT;
     size_t schnorr_records() const NOEXCEPT;
     size_t silent_records() const NOEXCEPT;
     size_t duplicate_records() const NOEXCEPT;
     size_t prevalid_records() const NOEXCEPT;
     size_t filter_bk_records() const NOEXCEPT;
+    size_t summary_records() const NOEXCEPT;
 
     /// Counters (archive slabs - txs/puts/filter_tx can be derived).
     size_t input_count(const tx_link& link) const NOEXCEPT;
@@ -230,6 +250,8 @@ public:
     /// Optional/configured table state.
     bool address_enabled() const NOEXCEPT;
     bool filter_enabled() const NOEXCEPT;
+    bool summary_enabled() const NOEXCEPT;
+    bool layout_enabled() const NOEXCEPT;
     size_t interval_span() const NOEXCEPT;
 
     /// Initialization (natural-keyed).
@@ -267,6 +289,9 @@ public:
     inline output_link to_output(const hash_digest& key,
         uint32_t output_index) const NOEXCEPT;
 
+    /// search keys (batched entry, prefetched)
+    tx_links to_txs(const hashes& keys) const NOEXCEPT;
+
     /// put to tx (reverse navigation)
     tx_link to_output_tx(const output_link& link) const NOEXCEPT;
     tx_link to_prevout_tx(const ins_link& link) const NOEXCEPT;
@@ -328,6 +353,7 @@ public:
     constexpr size_t to_validated_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_tx(const header_link& link) const NOEXCEPT;
+    constexpr size_t to_layout(const header_link& link) const NOEXCEPT;
     constexpr size_t to_prevout(const header_link& link) const NOEXCEPT;
     constexpr size_t to_txs(const header_link& link) const NOEXCEPT;
 
@@ -385,6 +411,12 @@ public:
     tx_link get_position_tx(const header_link& link,
         size_t position) const NOEXCEPT;
 
+    /// Wire tx offsets in block (layout table), false if not found/disabled.
+    bool get_tx_offset(size_t& offset, size_t& size, const header_link& link,
+        size_t position, bool witness) const NOEXCEPT;
+    bool get_offset_position(size_t& out, const header_link& link,
+        size_t offset, bool witness) const NOEXCEPT;
+
     /// Sizes.
     bool get_tx_size(size_t& out, const tx_link& link, bool witness) const NOEXCEPT;
     bool get_block_size(size_t& out, const header_link& link, bool witness) const NOEXCEPT;
@@ -422,6 +454,10 @@ public:
     data_chunk get_wire_tx(const tx_link& link, bool witness) const NOEXCEPT;
     data_chunk get_wire_block(const header_link& link, bool witness) const NOEXCEPT;
 
+    /// Chunked wire block (holds archive remap locks only within each call).
+    block_stream::ptr get_block_stream(const header_link& link,
+        bool witness) const NOEXCEPT;
+
     /// Objects.
     /// -----------------------------------------------------------------------
 
@@ -448,6 +484,12 @@ public:
     inputs_ptr get_spenders(const output_link& link,
         bool witness) const NOEXCEPT;
 
+    /// Views (lazily parsed over mapped rows, no per element allocation).
+    /// Views hold shared remap locks on archive tables, so table growth waits
+    /// on their release. Keep short-lived and never hold while writing.
+    archive_memory get_archive_memory() const NOEXCEPT;
+    stored_block::ptr get_stored_block(const header_link& link) const NOEXCEPT;
+
     /// Inpoint and outpoint result sets.
     outpoint get_outpoint(const output_link& link) const NOEXCEPT;
     inpoint get_spender(const ins_link& link) const NOEXCEPT;
@@ -463,6 +505,11 @@ public:
     bool populate_with_metadata(const block& block, bool chain=false) const NOEXCEPT;
     bool populate_with_metadata(const transaction& tx, bool chain=false) const NOEXCEPT;
 
+    /// Advise residency of block prevout outs/output rows ahead of population
+    /// and return the count of outputs advised (thread safe). Parent lookup
+    /// blocks on tx rows, so call from a worker as soon as block is archived.
+    size_t prefetch_prevouts(const block& block) const NOEXCEPT;
+
     /// Fees.
     /// -----------------------------------------------------------------------
 
@@ -681,6 +728,11 @@ public:
     bool pop_candidate() NOEXCEPT;
     bool pop_confirmed() NOEXCEPT;
 
+    /// Confirm links in order above top, or unconfirm all above height, in
+    /// one transactor scope with all strong_tx records written as a batch.
+    bool push_confirmed_range(const header_links& links, bool strong) NOEXCEPT;
+    bool pop_confirmed_to(size_t height) NOEXCEPT;
+
     /// Populate message payloads from locator.
     headers get_headers(const hashes& locator, const hash_digest& stop,
         size_t limit) const NOEXCEPT;
@@ -723,6 +775,10 @@ public:
     code get_unspent(const stopper& cancel, unspents& out,
         const hash_digest& key, bool turbo=false) const NOEXCEPT;
 
+    /// Confirmed aggregate (summary table), false if not found or disabled.
+    bool get_address_summary(address_summary& out,
+        const hash_digest& key) const NOEXCEPT;
+
     /// Balance queries (universal, unconfirmed conflict resolution arbitrary).
     code get_unconfirmed_balance(const stopper& cancel, uint64_t& out,
         const hash_digest& key, bool turbo=false) const NOEXCEPT;
@@ -839,6 +895,24 @@ protected:
     /// Support set_strong and set_unstrong writers.
     bool set_strong(const header_link& link, size_t count,
         const tx_link& first_fk, bool positive) NOEXCEPT;
+    bool set_strong_array(const header_link& link, size_t count,
+        const tx_link& first_fk, bool positive) NOEXCEPT;
+
+    /// Block and its contiguous tx links, for batched strong_tx writes.
+    struct strong_block
+    {
+        header_link link;
+        tx_link first_fk;
+        size_t count;
+    };
+    using strong_blocks = std::vector<strong_block>;
+
+    /// Support push_confirmed_range and pop_confirmed_to writers.
+    bool set_strongs(const strong_blocks& blocks, bool positive) NOEXCEPT;
+
+    /// Support push_confirmed and pop_confirmed writers (summary table).
+    bool set_summary(const header_link& link, bool positive) NOEXCEPT;
+    bool get_summary_last(size_t& out, const hash_digest& key) const NOEXCEPT;
 
     /// Get all tx links for any point of block that is also in duplicate table.
     bool get_doubles(tx_links& out, const block& block) const NOEXCEPT;
@@ -883,6 +957,23 @@ protected:
     bool populate_with_metadata_(const transaction& tx,
         bool chain) const NOEXCEPT;
 
+    /// Unpopulated block input and its resolved prevout parent tx.
+    struct prevout_ref
+    {
+        const input* in{};
+        tx_link tx{};
+        uint32_t index{};
+    };
+    using prevout_refs = std::vector<prevout_ref>;
+
+    /// Unpopulated non-coinbase inputs of block with parents resolved by
+    /// batched lookup of distinct hashes, ordered by ascending (tx, index).
+    prevout_refs to_prevout_refs(const block& block) const NOEXCEPT;
+
+    /// Populate from resolved parent (bypasses populated guard).
+    bool populate_with_metadata_(const input& input, const tx_link& tx,
+        bool chain) const NOEXCEPT;
+
     /// merkle
     /// -----------------------------------------------------------------------
 
@@ -931,10 +1022,36 @@ protected:
         outs_link outs_fk;
     };
 
+    /// Block tx write, its preallocated rows, collected duplicates and result.
+    template <typename Transaction>
+    struct tx_write
+    {
+        const Transaction* tx{};
+        allocation fks;
+        std::vector<point> twins;
+        code ec;
+    };
+
+    /// Minimum block tx count for concurrent tx writes.
+    static constexpr size_t parallel_writes = 64;
+
+    code set_code(std::vector<point>& twins, const accessors& ptrs,
+        const allocation& fks, const transaction& tx, bool bypass,
+        bool prune) NOEXCEPT;
     code set_code(std::vector<point>& twins, const accessors& ptrs,
         const allocation& fks,const transaction_view& tx, bool bypass,
         bool prune) NOEXCEPT;
 
+    /// Wire serialization into exactly presized buffers.
+    /// -----------------------------------------------------------------------
+
+    /// Write tx into a buffer of its wire size, using the caller's memory.
+    /// Witnesses are written at their computed offset in the same traversal
+    /// of inputs, so each ins and input row is read once.
+    bool get_wire_tx(const system::data_slab& buffer,
+        const archive_memory& memory, const table::transaction::record& tx,
+        bool witness) const NOEXCEPT;
+
     /// History.
     /// -----------------------------------------------------------------------
 
@@ -989,6 +1106,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/query/address/address_balance.ipp>
 #include <bitcoin/database/impl/query/address/address_history.ipp>
 #include <bitcoin/database/impl/query/address/address_outpoints.ipp>
+#include <bitcoin/database/impl/query/address/address_summary.ipp>
 #include <bitcoin/database/impl/query/address/address_unspent.ipp>
 
 #include <bitcoin/database/impl/query/archive/chain_reader.ipp>
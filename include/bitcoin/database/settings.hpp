@@ -69,6 +69,19 @@ struct BCD_API settings
     /// Fork flags upon store creation (used at store create only).
     uint32_t fork_flags{};
 
+    /// Index strong tx state by tx link (a change is rejected at store open).
+    /// The dense index is a three byte row per tx, held in RAM (unstaged, as
+    /// rows are rewritten in place) and copied in full by each full snapshot.
+    /// This is about 3.5GB at 1.2 billion txs. The sparse index is not loaded
+    /// when dense, and the dense index is empty when sparse.
+    bool dense_strong{ false };
+
+    /// Files concurrently opened/loaded, unloaded/closed and snapshot copied.
+    uint32_t file_concurrency{ 8 };
+
+    /// Incremental (changed head page) snapshots between full snapshots.
+    uint32_t snapshot_deltas{};
+
     /// Path to the database directory.
     std::filesystem::path path{ "bitcoin" };
 
@@ -89,6 +102,7 @@ struct BCD_API settings
     bucket_table candidate{};
     bucket_table confirmed{};
     bucket_table strong_tx{};
+    simple_table strong_array{};
 
     /// Caches.
     /// -----------------------------------------------------------------------
@@ -107,6 +121,16 @@ struct BCD_API settings
 
     bucket_table filter_bk{};
     bucket_table filter_tx{};
+
+    /// Confirmed address aggregates (zero buckets, the default, disables).
+    /// Requires the address index (outs), as a pop recomputes last height.
+    /// Enabled only at store creation, as confirmed history is not backfilled.
+    bucket_table summary{ {}, 0 };
+
+    /// Block tx offsets and hashes (zero buckets, the default, disables).
+    /// If added to an existing store only blocks archived thereafter are laid
+    /// out. Positional reads of others fall back to txs, offset reads fail.
+    bucket_table layout{ {}, 0 };
 };
 
 } // namespace database
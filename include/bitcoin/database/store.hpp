@@ -21,9 +21,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <functional>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/locks/locks.hpp>
 #include <bitcoin/database/settings.hpp>
@@ -36,7 +40,7 @@ namespace database {
 /// The store and query interface are the primary products of database.
 /// Store provides implmentation support for the public query interface.
 /// Query privides query interface implmentation over the store.
-/// Event handlers are invoked synchronously, providing progress.
+/// Event handlers are invoked synchronously (and serially), providing progress.
 template <template <size_t...> class Storage>
 class store
 {
@@ -45,6 +49,7 @@ public:
 
     typedef std::function<void(event_t, table_t)> event_handler;
     typedef std::function<void(const code&, table_t)> error_handler;
+    typedef std::function<void(const storage_stats&, table_t)> stats_handler;
     typedef std::shared_lock<std::shared_timed_mutex> transactor;
 
     /// Event and table names, useful for internal logging.
@@ -53,6 +58,14 @@ public:
     static const event_map events;
     static const table_map tables;
 
+    /// Snapshot head copy progress, rate is bytes/second since copy start.
+    struct copy_progress
+    {
+        size_t bytes;
+        size_t total;
+        size_t rate;
+    };
+
     /// Construct a store from settings.
     store(const settings& config) NOEXCEPT;
 
@@ -68,6 +81,13 @@ public:
     /// Prune prunable tables (from loaded, leaves loaded).
     code prune(const event_handler& handler) NOEXCEPT;
 
+    /// Rebuild hash heads to configured bucket counts by relinking their
+    /// bodies (from closed, leaves closed). All heads are validated, and all
+    /// resized tables verified with targets created, before any change.
+    /// Snapshots are discarded only before the first (in place) relink, and a
+    /// failure thereafter leaves the store corrupt.
+    code rehash(const event_handler& handler) NOEXCEPT;
+
     /// Snapshot the set of tables (from loaded, leaves loaded).
     code snapshot(const event_handler& handler, bool prune=false) NOEXCEPT;
 
@@ -80,6 +100,9 @@ public:
     /// Dump all error/full conditions to handler.
     void report(const error_handler& handler) const NOEXCEPT;
 
+    /// Dump runtime statistics of each table file to handler.
+    void report_stats(const stats_handler& handler) const NOEXCEPT;
+
     /// Unload and close the set of tables, clear locks.
     code close(const event_handler& handler) NOEXCEPT;
 
@@ -98,6 +121,9 @@ public:
     /// Fork flags upon store creation.
     uint32_t fork_flags() const NOEXCEPT;
 
+    /// Strong tx state is indexed by tx link (strong_array), configuration.
+    bool dense_strong() const NOEXCEPT;
+
     /// Determine if the store is non-empty/initialized.
     bool is_dirty() const NOEXCEPT;
     void set_dirty() NOEXCEPT;
@@ -108,9 +134,16 @@ public:
     /// Get the space required to clear the disk full condition.
     size_t get_space() const NOEXCEPT;
 
+    /// Get runtime statistics summed across all table files (row values sum
+    /// rows of differing widths, byte and event counters are exact).
+    storage_stats get_stats() const NOEXCEPT;
+
     /// Get a transactor object.
     transactor get_transactor() NOEXCEPT;
 
+    /// Get progress of the current (or last) snapshot head copy.
+    copy_progress get_copy_progress() const NOEXCEPT;
+
 protected:
     using path = std::filesystem::path;
 
@@ -118,8 +151,66 @@ protected:
     code create_load(const event_handler& handler) NOEXCEPT;
     code open_load(const event_handler& handler) NOEXCEPT;
     code unload_close(const event_handler& handler) NOEXCEPT;
+    code create_added(bool& added, storage& head, storage& body,
+        table_t head_table, table_t body_table, const event_handler& handler,
+        bool addable=true) NOEXCEPT;
+    code verify_fingerprint() const NOEXCEPT;
     code backup(const event_handler& handler, bool prune=false) NOEXCEPT;
-    code dump(const path& folder, const event_handler& handler) NOEXCEPT;
+    code dump(const path& folder, const event_handler& handler,
+        size_t generation=zero) NOEXCEPT;
+    code replay(const path& folder, const event_handler& handler) NOEXCEPT;
+
+    /// Buckets of a closed table head, implied by its logical size.
+    template <size_t Cell>
+    code rehash_buckets(uint32_t& buckets, const std::string& name) NOEXCEPT;
+
+    /// Validate that a closed table head can be rebuilt to configured buckets.
+    template <typename Table, size_t Cell>
+    code rehash_check(bool& resized, const std::string& name,
+        const settings::bucket_table& config) NOEXCEPT;
+
+    /// Create the temporary head and verify the closed table if resized.
+    template <typename Table, size_t Cell, typename Body = Storage<one>>
+    code rehash_prepare(const std::string& name,
+        const settings::bucket_table& config) NOEXCEPT;
+
+    /// Relink a closed table into its prepared temporary head if resized.
+    template <typename Table, size_t Cell, typename Body = Storage<one>>
+    code rehash_table(const event_handler& handler, const std::string& name,
+        const settings::bucket_table& config, table_t table) NOEXCEPT;
+
+    /// Replace the head of a table with its relinked temporary, if any.
+    code rehash_commit(const std::string& name) NOEXCEPT;
+
+    /// Table file (head or body) and its table identifier.
+    struct table_file
+    {
+        storage& file;
+        table_t table;
+    };
+
+    using table_files = std::vector<table_file>;
+    using file_operation = std::function<code(const event_handler&, storage&,
+        table_t)>;
+
+    /// All table files, in table order.
+    table_files files() NOEXCEPT;
+
+    /// Snapshot head files, in table order, and their snapshot names.
+    table_files heads() NOEXCEPT;
+    static const table_map snapshots;
+
+    /// Snapshot bodies (rows rewritten in place) and their body file names.
+    static const table_map rewritten;
+
+    /// True if all heads track changes since their last dump.
+    bool tracked() NOEXCEPT;
+
+    /// Apply operation to each file across configured file concurrency, with
+    /// handler invocations serialized. No file is started after a failure,
+    /// and the first failure in file order is returned (deterministic).
+    code for_each_file(const table_files& items, const event_handler& handler,
+        const file_operation& operation) const NOEXCEPT;
 
     // This is thread safe.
     const settings& configuration_;
@@ -169,6 +260,10 @@ protected:
     Storage<one> strong_tx_head_;
     Storage<one> strong_tx_body_;
 
+    // array
+    Storage<one> strong_array_head_;
+    Storage<one> strong_array_body_;
+
     /// Caches.
     /// -----------------------------------------------------------------------
 
@@ -215,6 +310,14 @@ protected:
     Storage<one> filter_tx_head_;
     Storage<one> filter_tx_body_;
 
+    // record hashmap
+    Storage<one> summary_head_;
+    Storage<one> summary_body_;
+
+    // slab arraymap
+    Storage<one> layout_head_;
+    Storage<one> layout_body_;
+
     /// Locks.
     /// -----------------------------------------------------------------------
 
@@ -226,6 +329,14 @@ protected:
     // This is thread safe.
     stopper dirty_{ true };
 
+    // These are thread safe (snapshot head copy progress).
+    std::atomic<size_t> copy_bytes_{};
+    std::atomic<size_t> copy_total_{};
+    std::atomic<int64_t> copy_start_{};
+
+    // This is protected by transactor_mutex_ (delta generations in primary).
+    size_t deltas_{};
+
 private:
     static constexpr bool random = true;
     static constexpr bool sequential = false;
@@ -269,6 +380,18 @@ private:
         return folder / (name + schema::ext::lock);
     }
 
+    static inline path delta(const path& folder, const std::string& name,
+        size_t generation) NOEXCEPT
+    {
+        return folder / (name + "." + std::to_string(generation) +
+            schema::ext::delta);
+    }
+
+    static inline path marker(const path& folder, size_t generation) NOEXCEPT
+    {
+        return folder / (std::to_string(generation) + schema::ext::delta);
+    }
+
 public:
     /// Tables.
     /// -----------------------------------------------------------------------
@@ -286,6 +409,7 @@ public:
     table::height candidate;
     table::height confirmed;
     table::strong_tx strong_tx;
+    table::strong_array strong_array;
 
     /// Caches.
     table::ecdsa<Storage> ecdsa;
@@ -300,6 +424,8 @@ public:
     /// Optionals.
     table::filter_bk filter_bk;
     table::filter_tx filter_tx;
+    table::summary summary;
+    table::layout layout;
 };
 
 } // namespace database
@@ -320,6 +446,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/store/store_create.ipp>
 #include <bitcoin/database/impl/store/store_open.ipp>
 #include <bitcoin/database/impl/store/store_prune.ipp>
+#include <bitcoin/database/impl/store/store_rehash.ipp>
 #include <bitcoin/database/impl/store/store_snapshot.ipp>
 #include <bitcoin/database/impl/store/store_restore.ipp>
 #include <bitcoin/database/impl/store/store_reload.ipp>
@@ -327,6 +454,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/store/store_close.ipp>
 
 // Protected methods.
+#include <bitcoin/database/impl/store/store_files.ipp>
 #include <bitcoin/database/impl/store/store_open_load.ipp>
 #include <bitcoin/database/impl/store/store_unload_close.ipp>
 #include <bitcoin/database/impl/store/store_backup.ipp>
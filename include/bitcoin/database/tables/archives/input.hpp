@@ -139,6 +139,38 @@ struct input
         system::chain::witness::cptr witness{};
     };
 
+    /// Unstreamed, slices the script and serialized witness in place.
+    struct get_slices
+      : public schema::input
+    {
+        inline bool from_data(memory::iterator start) NOEXCEPT
+        {
+            using namespace system;
+
+            // Read the script size, and slice the script bytes.
+            const auto* position = start;
+            const auto scrypt_size = unsafe_from_variable(position);
+            const auto bytes = possible_narrow_cast<size_t>(scrypt_size);
+            script = { position, std::next(position, bytes) };
+            std::advance(position, bytes);
+
+            // Skip each witness element, and slice the full serialization.
+            const auto* witness_start = position;
+            const auto count = unsafe_from_variable(position);
+            for (uint64_t element{}; element < count; ++element)
+            {
+                const auto size = unsafe_from_variable(position);
+                std::advance(position, possible_narrow_cast<size_t>(size));
+            }
+
+            witness = { witness_start, position };
+            return true;
+        }
+
+        system::data_slice script{};
+        system::data_slice witness{};
+    };
+
     struct put_ref
       : public schema::input
     {
@@ -277,6 +309,47 @@ struct input
         bytewriter& sink;
     };
 
+    /// Unstreamed, writes the script and the witness (if witnessed) to their
+    /// separate sinks from a single read of the slab.
+    struct wire_input
+      : public schema::input
+    {
+        inline bool from_data(memory::iterator start) NOEXCEPT
+        {
+            using namespace system;
+
+            // script (prefixed)
+            const auto* position = start;
+            const auto scrypt_size = unsafe_from_variable(position);
+            const auto bytes = possible_narrow_cast<size_t>(scrypt_size);
+            sink.write_variable(scrypt_size);
+            sink.write_bytes(position, bytes);
+            if (!witnessed)
+                return sink;
+
+            // witness (count)
+            std::advance(position, bytes);
+            const auto count = unsafe_from_variable(position);
+            witness_sink.write_variable(count);
+
+            // witness (prefixed)
+            for (uint64_t element{}; element < count; ++element)
+            {
+                const auto length = unsafe_from_variable(position);
+                const auto size = possible_narrow_cast<size_t>(length);
+                witness_sink.write_variable(length);
+                witness_sink.write_bytes(position, size);
+                std::advance(position, size);
+            }
+
+            return sink && witness_sink;
+        }
+
+        bytewriter& sink;
+        bytewriter& witness_sink;
+        bool witnessed{};
+    };
+
     struct wire_witness
       : public schema::input
     {
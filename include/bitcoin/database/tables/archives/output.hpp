@@ -153,6 +153,48 @@ struct output
         bool match{};
     };
 
+    /// Unstreamed, reads the value and hashes the script in place.
+    struct get_value_script_hash
+      : public schema::output
+    {
+        inline bool from_data(memory::iterator start) NOEXCEPT
+        {
+            using namespace system;
+
+            // Skip parent fk, read the value and the script size.
+            const auto* position = std::next(start, tx::size);
+            value = unsafe_from_variable(position);
+            const auto scrypt_size = unsafe_from_variable(position);
+            const auto bytes = possible_narrow_cast<size_t>(scrypt_size);
+            key = accumulator<sha256>::hash(bytes, position);
+            return true;
+        }
+
+        uint64_t value{};
+        system::hash_digest key{};
+    };
+
+    /// Unstreamed, reads the value and slices the script in place.
+    struct get_slices
+      : public schema::output
+    {
+        inline bool from_data(memory::iterator start) NOEXCEPT
+        {
+            using namespace system;
+
+            // Skip parent fk, read the value and the script size.
+            const auto* position = std::next(start, tx::size);
+            value = unsafe_from_variable(position);
+            const auto scrypt_size = unsafe_from_variable(position);
+            const auto bytes = possible_narrow_cast<size_t>(scrypt_size);
+            script = { position, std::next(position, bytes) };
+            return true;
+        }
+
+        uint64_t value{};
+        system::data_slice script{};
+    };
+
     struct get_parent_value
       : public schema::output
     {
@@ -307,6 +349,29 @@ struct output
 
         bytewriter& sink;
     };
+
+    /// Unstreamed, writes the value and script directly from the slab.
+    struct wire_output
+      : public schema::output
+    {
+        inline bool from_data(memory::iterator start) NOEXCEPT
+        {
+            using namespace system;
+
+            // skip: parent_fk, value (translates from variable to fixed width)
+            const auto* position = std::next(start, tx::size);
+            sink.write_8_bytes_little_endian(unsafe_from_variable(position));
+
+            // script (prefixed)
+            const auto scrypt_size = unsafe_from_variable(position);
+            const auto bytes = possible_narrow_cast<size_t>(scrypt_size);
+            sink.write_variable(scrypt_size);
+            sink.write_bytes(position, bytes);
+            return sink;
+        }
+
+        bytewriter& sink;
+    };
 };
 
 BC_POP_WARNING()
@@ -29,7 +29,8 @@ namespace libbitcoin {
 namespace database {
 namespace table {
 
-/// Address spine (column zero): conflict link, no stored value or key.
+/// Address spine (column zero): conflict link and optional stored script
+/// hash fragment (schema::fingerprint bytes), no stored value.
 struct outs_address
 {
     using link = schema::address::link;
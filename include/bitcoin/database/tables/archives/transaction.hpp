@@ -140,6 +140,21 @@ struct transaction
         outs::integer outs_fk{};
     };
 
+    struct record_with_sk
+      : public record
+    {
+        BC_PUSH_WARNING(NO_METHOD_HIDING)
+        inline bool from_data(reader& source) NOEXCEPT
+        BC_POP_WARNING()
+        {
+            source.rewind_bytes(sk);
+            key = source.read_hash();
+            return record::from_data(source);
+        }
+
+        key key{};
+    };
+
     struct only
       : public schema::transaction
     {
@@ -39,11 +39,14 @@ enum class event_t
     wait_lock,
     flush_body,
     prune_table,
+    rehash_table,
     backup_table,
     copy_header,
+    copy_progress,
     archive_snapshot,
 
     restore_table,
+    replay_delta,
     recover_snapshot
 };
 
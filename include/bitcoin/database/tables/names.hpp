@@ -52,6 +52,7 @@ namespace indexes
     constexpr auto candidate = "index_candidate";
     constexpr auto confirmed = "index_confirmed";
     constexpr auto strong_tx = "index_strong";
+    constexpr auto strong_array = "index_strong_array";
 }
 
 namespace caches
@@ -88,6 +89,8 @@ namespace optionals
     constexpr auto address = "option_address";
     constexpr auto filter_bk = "option_filter_bk";
     constexpr auto filter_tx = "option_filter_tx";
+    constexpr auto summary = "option_summary";
+    constexpr auto layout = "option_layout";
 }
 
 namespace locks
@@ -101,6 +104,7 @@ namespace ext
     constexpr auto head = ".head";
     constexpr auto data = ".data";
     constexpr auto lock = ".lock";
+    constexpr auto delta = ".delta";
 }
 
 } // namespace schema
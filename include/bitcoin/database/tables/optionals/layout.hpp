@@ -0,0 +1,333 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_LAYOUT_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_LAYOUT_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// layout is a slab of block tx offsets and hashes indexed by block link.
+/// Written only by the block writers, which allocate the block's tx records
+/// contiguously, so tx position is the offset of a tx fk from the coinbase fk.
+/// Offsets are from the start of the wire block, with a final (end) offset.
+struct layout
+  : public array_map<schema::layout>
+{
+    using ct = linkage<schema::count_>;
+    using tx = schema::transaction::link;
+    using bytes = linkage<schema::size>;
+    using array_map<schema::layout>::arraymap;
+
+    static constexpr size_t offsets_size(size_t number) NOEXCEPT
+    {
+        return add1(number) * bytes::size;
+    }
+
+    static constexpr size_t slab_size(size_t number) NOEXCEPT
+    {
+        return ct::size + tx::size + offsets_size(number) +
+            offsets_size(number) + number * schema::hash;
+    }
+
+    // Position the reader at the light (or heavy) offsets, returns count.
+    static inline size_t skip_to_offsets(reader& source,
+        bool witness) NOEXCEPT
+    {
+        const auto number = source.read_little_endian<ct::integer, ct::size>();
+        source.skip_bytes(tx::size);
+        if (witness) source.skip_bytes(offsets_size(number));
+        return number;
+    }
+
+    // Position the reader at the tx hashes, returns count.
+    static inline size_t skip_to_hashes(reader& source) NOEXCEPT
+    {
+        const auto number = skip_to_offsets(source, true);
+        source.skip_bytes(offsets_size(number));
+        return number;
+    }
+
+    struct put_ref
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            return system::possible_narrow_cast<link::integer>(
+                slab_size(block.transactions()));
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            using namespace system;
+            const auto& txs = *block.transactions_ptr();
+            const auto number = txs.size();
+            const auto start = chain::header::serialized_size() +
+                variable_size(number);
+
+            sink.write_little_endian<ct::integer, ct::size>(
+                possible_narrow_cast<ct::integer>(number));
+            sink.write_little_endian<tx::integer, tx::size>(tx_fk);
+
+            for (const auto witness: { false, true })
+            {
+                auto offset = start;
+                for (const auto& tx: txs)
+                {
+                    sink.write_little_endian<bytes::integer, bytes::size>(
+                        possible_narrow_cast<bytes::integer>(offset));
+                    offset += tx->serialized_size(witness);
+                }
+
+                sink.write_little_endian<bytes::integer, bytes::size>(
+                    possible_narrow_cast<bytes::integer>(offset));
+            }
+
+            for (const auto& tx: txs)
+                sink.write_bytes(tx->hash(false));
+
+            BC_ASSERT(!sink || sink.get_write_position() == count());
+            return sink;
+        }
+
+        const tx::integer tx_fk{};
+        const system::chain::block& block;
+    };
+
+    struct put_view
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            return system::possible_narrow_cast<link::integer>(
+                slab_size(block.transactions()));
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            using namespace system;
+            const auto number = block.transactions();
+            const auto start = chain::header::serialized_size() +
+                variable_size(number);
+
+            sink.write_little_endian<ct::integer, ct::size>(
+                possible_narrow_cast<ct::integer>(number));
+            sink.write_little_endian<tx::integer, tx::size>(tx_fk);
+
+            for (const auto witness: { false, true })
+            {
+                auto offset = start;
+                for (const auto& tx: block.views())
+                {
+                    sink.write_little_endian<bytes::integer, bytes::size>(
+                        possible_narrow_cast<bytes::integer>(offset));
+                    offset += tx.serialized_size(witness);
+                }
+
+                sink.write_little_endian<bytes::integer, bytes::size>(
+                    possible_narrow_cast<bytes::integer>(offset));
+            }
+
+            for (const auto& tx: block.views())
+                sink.write_bytes(tx.hash(false));
+
+            BC_ASSERT(!sink || sink.get_write_position() == count());
+            return sink;
+        }
+
+        const tx::integer tx_fk{};
+        const system::chain::block_view& block;
+    };
+
+    struct get_hashes
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        // Overallocated as required for the common merkle scenario.
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            using namespace system;
+            const auto number = skip_to_hashes(source);
+            const auto size = is_odd(number) && !is_one(number) ?
+                add1(number) : number;
+
+            hashes.clear();
+            hashes.reserve(size);
+            for (size_t index{}; index < number; ++index)
+                hashes.push_back(source.read_hash());
+
+            return source;
+        }
+
+        system::hashes hashes{};
+    };
+
+    struct get_position
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            const auto number = source.read_little_endian<ct::integer, ct::size>();
+            const auto coinbase_fk = source.read_little_endian<tx::integer, tx::size>();
+            if (tx_fk >= coinbase_fk && tx_fk - coinbase_fk < number)
+            {
+                position = tx_fk - coinbase_fk;
+                return source;
+            }
+
+            source.invalidate();
+            return source;
+        }
+
+        const tx::integer tx_fk{};
+        size_t position{};
+    };
+
+    struct get_at_position
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            const auto number = source.read_little_endian<ct::integer, ct::size>();
+            const auto coinbase_fk = source.read_little_endian<tx::integer, tx::size>();
+            if (position < number)
+            {
+                tx_fk = system::possible_narrow_cast<tx::integer>(
+                    coinbase_fk + position);
+                return source;
+            }
+
+            source.invalidate();
+            return source;
+        }
+
+        const size_t position{};
+        tx::integer tx_fk{};
+    };
+
+    // Wire offset and size of the tx at position.
+    struct get_offset
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            const auto number = skip_to_offsets(source, witness);
+            if (position < number)
+            {
+                source.skip_bytes(position * bytes::size);
+                offset = source.read_little_endian<bytes::integer, bytes::size>();
+                size = source.read_little_endian<bytes::integer, bytes::size>() -
+                    offset;
+                return source;
+            }
+
+            source.invalidate();
+            return source;
+        }
+
+        const size_t position{};
+        const bool witness{};
+        size_t offset{};
+        size_t size{};
+    };
+
+    // Position of the tx containing the wire block byte at offset.
+    struct get_at_offset
+      : public schema::layout
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            const auto number = skip_to_offsets(source, witness);
+            const auto start = source.get_read_position();
+            const auto read = [&](size_t index) NOEXCEPT
+            {
+                const auto to = start + index * bytes::size;
+                const auto at = source.get_read_position();
+                if (to > at) source.skip_bytes(to - at);
+                if (to < at) source.rewind_bytes(at - to);
+                return source.read_little_endian<bytes::integer, bytes::size>();
+            };
+
+            // Header and tx count bytes are not within a tx.
+            if (offset < read(zero) || offset >= read(number))
+            {
+                source.invalidate();
+                return source;
+            }
+
+            // Binary search, with offset(first) <= offset < offset(last).
+            size_t first{};
+            size_t last{ number };
+            while (last - first > one)
+            {
+                const auto middle = first + to_half(last - first);
+                if (read(middle) <= offset)
+                    first = middle;
+                else
+                    last = middle;
+            }
+
+            position = first;
+            return source;
+        }
+
+        const size_t offset{};
+        const bool witness{};
+        size_t position{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_SUMMARY_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_SUMMARY_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// summary is a record hashmap of confirmed address aggregates, searched by
+/// output script hash and rewritten in place as blocks are (un)confirmed.
+struct summary
+  : public hash_map<schema::summary>
+{
+    using height = linkage<schema::height_>;
+    using hash_map<schema::summary>::hashmap;
+
+    struct record
+      : public schema::summary
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            balance = source.read_little_endian<uint64_t>();
+            funded = source.read_little_endian<uint32_t>();
+            spent = source.read_little_endian<uint32_t>();
+            first = source.read_little_endian<height::integer, height::size>();
+            last = source.read_little_endian<height::integer, height::size>();
+            BC_ASSERT(!source || source.get_read_position() == minrow);
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            sink.write_little_endian<uint64_t>(balance);
+            sink.write_little_endian<uint32_t>(funded);
+            sink.write_little_endian<uint32_t>(spent);
+            sink.write_little_endian<height::integer, height::size>(first);
+            sink.write_little_endian<height::integer, height::size>(last);
+            BC_ASSERT(!sink || sink.get_write_position() == minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return balance == other.balance
+                && funded == other.funded
+                && spent == other.spent
+                && first == other.first
+                && last == other.last;
+        }
+
+        uint64_t balance{};
+        uint32_t funded{};
+        uint32_t spent{};
+        height::integer first{};
+        height::integer last{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -23,6 +23,14 @@
 #include <bitcoin/database/primitives/keys.hpp>
 #include <bitcoin/database/tables/names.hpp>
 
+/// Bytes of output script hash stored in the address spine, zero (default)
+/// for none, up to 16 (fragment, loose) or 32 (exact). A nonzero fragment
+/// filters co-bucket rows in the spine instead of the output body. Set by the
+/// build (address-fingerprint), a store of another width fails to open.
+#if !defined(BCD_ADDRESS_FINGERPRINT)
+    #define BCD_ADDRESS_FINGERPRINT 0
+#endif
+
 #define TABLE_COLUMN(table, bytes) \
 struct table \
 { \
@@ -50,6 +58,7 @@ constexpr size_t sigops = 3;    // signature op count.
 constexpr size_t flags = 4;     // fork flags.
 constexpr size_t prefix = 8;    // silent payment output prefix.
 constexpr size_t hash = system::hash_size;
+constexpr size_t fingerprint = BCD_ADDRESS_FINGERPRINT;
 
 /// Primary keys.
 /// -----------------------------------------------------------------------
@@ -64,6 +73,8 @@ constexpr size_t tx = 4;        // ->tx record.
 constexpr size_t block = 3;     // ->header record.
 constexpr size_t tx_slab = 5;   // ->validated_tx record.
 constexpr size_t filter_ = 5;   // ->filter record.
+constexpr size_t summary_ = 4;  // ->summary record.
+constexpr size_t layout_ = 5;   // ->layout slab.
 constexpr size_t doubles_ = 4;  // doubles bucket (no actual keys).
 
 /// Archive tables.
@@ -200,10 +211,10 @@ struct ins_sequence
     static_assert(link::size == 4u);
 };
 
-// record multimap spine (optional head, output script hash key)
+// record multimap spine (optional head, output script hash key fragment)
 struct address
 {
-    static constexpr size_t sk = zero;
+    static constexpr size_t sk = schema::fingerprint;
     static constexpr size_t pk = schema::outs_;
     using link = linkage<pk, to_bits(pk)>;
     using key = keys::search<sk>;
@@ -214,7 +225,7 @@ struct address
     static constexpr size_t cell = link::size;
     static constexpr link count() NOEXCEPT { return 1; }
     static_assert(minsize == 0u);
-    static_assert(minrow == 4u);
+    static_assert(minrow == 4u + sk);
     static_assert(link::size == 4u);
     static_assert(cell == 4u);
 };
@@ -294,6 +305,24 @@ struct strong_tx
     static_assert(cell == 4u);
 };
 
+// array (dense strong_tx, indexed by tx link)
+struct strong_array
+{
+    static constexpr size_t pk = schema::transaction::pk;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        ////schema::bit +     // positive (merged bit into header::pk)
+        schema::header::pk;
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr size_t cell = link::size;
+    static constexpr auto suffix = "strong"_t;
+    static_assert(minsize == 3u);
+    static_assert(minrow == 3u);
+    static_assert(link::size == 4u);
+    static_assert(cell == 4u);
+};
+
 /// Cache tables.
 /// ---------------------------------------------------------------------------
 
@@ -430,6 +459,48 @@ struct filter_tx
     static_assert(link::size == 5u);
 };
 
+// record hashmap (output script hash)
+struct summary
+{
+    static constexpr size_t sk = schema::hash;
+    static constexpr size_t pk = schema::summary_;
+    using link = linkage<pk, to_bits(pk)>;
+    using key = system::data_array<sk>;
+    static constexpr size_t minsize =
+        sizeof(uint64_t) +      // confirmed balance
+        sizeof(uint32_t) +      // funded (confirmed outputs)
+        sizeof(uint32_t) +      // spent (confirmed spends)
+        schema::height_ +       // first height
+        schema::height_;        // last height (upper bound)
+    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t size = minsize;
+    static constexpr size_t cell = link::size;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 22u);
+    static_assert(minrow == 58u);
+    static_assert(link::size == 4u);
+    static_assert(cell == 4u);
+};
+
+// slab arraymap
+struct layout
+{
+    static constexpr size_t align = false;
+    static constexpr size_t pk = schema::layout_;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        count_ +                // txs
+        schema::transaction::pk+// coinbase tx
+        schema::size +          // light end offset
+        schema::size;           // heavy end offset
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = max_size_t;
+    static inline link count() NOEXCEPT;
+    static_assert(minsize == 12u);
+    static_assert(minrow == 12u);
+    static_assert(link::size == 5u);
+};
+
 } // namespace schema
 } // namespace database
 } // namespace libbitcoin
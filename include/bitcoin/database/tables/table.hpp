@@ -62,6 +62,9 @@ enum class table_t
     strong_tx_table,
     strong_tx_head,
     strong_tx_body,
+    strong_array_table,
+    strong_array_head,
+    strong_array_body,
 
     /// Caches.
     ecdsa_table,
@@ -98,7 +101,13 @@ enum class table_t
     filter_bk_body,
     filter_tx_table,
     filter_tx_head,
-    filter_tx_body
+    filter_tx_body,
+    summary_table,
+    summary_head,
+    summary_body,
+    layout_table,
+    layout_head,
+    layout_body
 };
 
 } // namespace database
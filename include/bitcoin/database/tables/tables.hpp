@@ -37,11 +37,14 @@
 #include <bitcoin/database/tables/caches/validated_tx.hpp>
 
 #include <bitcoin/database/tables/indexes/height.hpp>
+#include <bitcoin/database/tables/indexes/strong_array.hpp>
 #include <bitcoin/database/tables/indexes/strong_tx.hpp>
 
 #include <bitcoin/database/tables/optionals/address.hpp>
 #include <bitcoin/database/tables/optionals/filter_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_tx.hpp>
+#include <bitcoin/database/tables/optionals/layout.hpp>
+#include <bitcoin/database/tables/optionals/summary.hpp>
 
 #include <bitcoin/database/tables/context.hpp>
 #include <bitcoin/database/tables/event.hpp>
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_ADDRESS_SUMMARY_HPP
+#define LIBBITCOIN_DATABASE_TYPES_ADDRESS_SUMMARY_HPP
+
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Confirmed aggregate of an output script hash (summary table).
+struct BCD_API address_summary
+{
+    /// Sum of confirmed unspent output values.
+    uint64_t balance;
+
+    /// Confirmed outputs and confirmed spends of them (funded + spent bounds
+    /// the confirmed history size from above).
+    size_t funded;
+    size_t spent;
+
+    /// Heights of first and last confirmed activity. The last height is an
+    /// upper bound following reorganization (first is exact).
+    size_t first;
+    size_t last;
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_BLOCK_STREAM_HPP
+#define LIBBITCOIN_DATABASE_TYPES_BLOCK_STREAM_HPP
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/types/stored_block.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Resumable wire serialization of a stored block, in bounded pieces.
+/// Bytes are yielded in wire order (header, tx count, txs), with scripts and
+/// witnesses sliced from mapped rows, as they are stored in wire layout. Other
+/// fields are generated into a small internal buffer. Retains only links and
+/// position between calls, with archive memory (remap locks) obtained for each
+/// read or gather, so a stream may be held across send pacing without blocking
+/// table growth. Must not outlive the source of its memory (query).
+class BCD_API block_stream
+{
+public:
+    DELETE_COPY_MOVE(block_stream);
+
+    using ptr = std::shared_ptr<block_stream>;
+    using memory_getter = std::function<archive_memory()>;
+    using slices = std::vector<system::data_slice>;
+    using header_bytes =
+        system::data_array<system::chain::header::serialized_size()>;
+
+    /// Generated bytes gathered per call (bounds the number of slices).
+    static constexpr size_t arena_size = 4096;
+
+    block_stream(memory_getter&& memory, tx_links&& txs,
+        const header_bytes& header, bool witness) NOEXCEPT;
+
+    /// True if all bytes have been yielded (or upon fault).
+    bool done() const NOEXCEPT;
+
+    /// True if a stored row could not be read.
+    bool fault() const NOEXCEPT;
+
+    /// Copy up to buffer.size() of the next bytes, returns the number copied.
+    /// Less than buffer.size() is returned only when done. Memory is held only
+    /// for the duration of the call.
+    size_t read(const system::data_slab& buffer) NOEXCEPT;
+
+    /// Clear and populate out with scatter/gather slices (e.g. for writev) of
+    /// up to limit of the next bytes, returns the number sliced. Mapped bytes
+    /// are sliced in place and generated bytes from an internal arena, so the
+    /// slices are valid only until the next call (or release). The memory of
+    /// mapped slices is held until then, so send and release promptly. Slices
+    /// are consumed when returned, so a caller must retain any it does not
+    /// fully send.
+    size_t gather(slices& out, size_t limit) NOEXCEPT;
+
+    /// Release memory held for the slices of the last gather (idempotent).
+    void release() NOEXCEPT;
+
+private:
+    enum class step
+    {
+        header,
+        count,
+        transaction,
+        input,
+        script,
+        sequence,
+        output,
+        output_script,
+        witness,
+        locktime,
+        done
+    };
+
+    // Generated piece upper bound (point and script size prefix).
+    static constexpr size_t pending_size = 64;
+
+    template <typename Writer>
+    void generate(const Writer& writer) NOEXCEPT;
+    bool acquire() NOEXCEPT;
+    bool resume() NOEXCEPT;
+    bool next() NOEXCEPT;
+    bool failed() NOEXCEPT;
+
+    // These are not thread safe.
+    const memory_getter get_memory_;
+    const tx_links txs_;
+    const header_bytes header_;
+    const bool witness_;
+    archive_memory memory_{};
+    std::optional<stored_transaction> tx_{};
+    stored_input input_{};
+    stored_output output_{};
+    step step_{ step::header };
+    step mapped_{ step::done };
+    size_t position_{};
+    size_t index_{};
+    bool witnessed_{};
+    bool fault_{};
+
+    // The current piece and the bytes of it already yielded.
+    system::data_slice piece_{};
+    size_t offset_{};
+    std::array<uint8_t, pending_size> pending_{};
+    std::array<uint8_t, arena_size> arena_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_STORED_BLOCK_HPP
+#define LIBBITCOIN_DATABASE_TYPES_STORED_BLOCK_HPP
+
+#include <memory>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/tables/tables.hpp>
+#include <bitcoin/database/types/type.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Body memory of the archive tables read by stored views.
+/// Each member holds a shared remap lock, so table growth (remap) waits until
+/// this is released. Hold only briefly, and never on a thread that writes to
+/// the store, as a write requiring remap would then deadlock.
+struct archive_memory
+{
+    inline operator bool() const NOEXCEPT
+    {
+        return tx && ins && sequence && puts && input && output;
+    }
+
+    memory tx{};
+    memory ins{};
+    memory sequence{};
+    memory puts{};
+    memory input{};
+    memory output{};
+};
+
+/// Stored input fields, script and witness are slices of mapped memory.
+/// The script is unprefixed, the witness is its (count prefixed) serialized
+/// stack, which is a single zero byte when not witnessed.
+struct stored_input
+{
+    system::hash_digest hash{};
+    uint32_t index{};
+    uint32_t sequence{};
+    system::data_slice script{};
+    system::data_slice witness{};
+};
+
+/// Stored output fields, script is an unprefixed slice of mapped memory.
+struct stored_output
+{
+    uint64_t value{};
+    system::data_slice script{};
+};
+
+/// Non-owning view of a stored transaction, parsed lazily from table rows.
+/// Slices are valid only for the lifetime of the referenced archive_memory.
+class BCD_API stored_transaction
+{
+public:
+    /// Reads only the transaction row, invalid if not found.
+    stored_transaction(const archive_memory& memory,
+        const tx_link& link) NOEXCEPT;
+
+    /// True if the transaction row was read.
+    operator bool() const NOEXCEPT;
+
+    /// Transaction row fields.
+    const system::hash_digest& hash() const NOEXCEPT;
+    uint32_t version() const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+    bool is_coinbase() const NOEXCEPT;
+    size_t inputs() const NOEXCEPT;
+    size_t outputs() const NOEXCEPT;
+
+    /// Wire serialized sizes (without and with witness).
+    size_t light() const NOEXCEPT;
+    size_t heavy() const NOEXCEPT;
+
+    /// Read the input or output at index, false if not found.
+    bool get_input(stored_input& out, size_t index) const NOEXCEPT;
+    bool get_output(stored_output& out, size_t index) const NOEXCEPT;
+
+private:
+    const archive_memory& memory_;
+    table::transaction::record_with_sk tx_{};
+    bool valid_{};
+};
+
+/// Non-owning view of a stored block's transactions.
+/// Owns the archive memory (remap locks) over which transactions are viewed,
+/// so a stored_transaction must not outlive the stored_block it came from.
+/// Transactions reference this memory, so it is not movable (held by ptr).
+class BCD_API stored_block
+{
+public:
+    DELETE_COPY_MOVE(stored_block);
+
+    using ptr = std::shared_ptr<stored_block>;
+
+    /// Default is invalid.
+    stored_block() NOEXCEPT;
+    stored_block(archive_memory&& memory, tx_links&& txs) NOEXCEPT;
+
+    /// True if memory is held and there is at least one transaction.
+    operator bool() const NOEXCEPT;
+
+    /// Number of transactions in the block.
+    size_t transactions() const NOEXCEPT;
+
+    /// View of the transaction at position (invalid if out of range).
+    stored_transaction transaction(size_t position) const NOEXCEPT;
+
+    /// Release remap locks, invalidating all views (idempotent).
+    void reset() NOEXCEPT;
+
+private:
+    archive_memory memory_{};
+    tx_links txs_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -19,9 +19,11 @@
 #ifndef LIBBITCOIN_DATABASE_TYPES_TYPES_HPP
 #define LIBBITCOIN_DATABASE_TYPES_TYPES_HPP
 
+#include <bitcoin/database/types/address_summary.hpp>
 #include <bitcoin/database/types/association.hpp>
 #include <bitcoin/database/types/associations.hpp>
 #include <bitcoin/database/types/block_state.hpp>
+#include <bitcoin/database/types/block_stream.hpp>
 #include <bitcoin/database/types/fee_rate.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
@@ -29,6 +31,7 @@
 #include <bitcoin/database/types/point_set.hpp>
 #include <bitcoin/database/types/position.hpp>
 #include <bitcoin/database/types/span.hpp>
+#include <bitcoin/database/types/stored_block.hpp>
 #include <bitcoin/database/types/tx_state.hpp>
 #include <bitcoin/database/types/type.hpp>
 #include <bitcoin/database/types/unspent.hpp>
@@ -83,6 +83,8 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { not_coalesced, "not coalesced" },
     { missing_snapshot, "missing snapshot" },
     { unloaded_file, "file not loaded" },
+    { untracked_file, "file changes not tracked" },
+    { invalid_delta, "invalid snapshot delta" },
 
     // tables
     { create_table, "failed to create table" },
@@ -91,6 +93,10 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { backup_table, "failed to backup table" },
     { restore_table, "failed to restore table" },
     { verify_table, "failed to verify table" },
+    { rehash_table, "failed to rehash table" },
+    { strong_mode, "strong index does not match dense_strong setting" },
+    { unbuilt_table, "table cannot be enabled on an existing store" },
+    { fingerprint_width, "address fingerprint does not match store" },
 
     // states
     { tx_connected, "transaction connected" },
@@ -127,6 +133,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { txs_height, "txs_height" },
     { txs_confirm, "txs_confirm" },
     { txs_txs_put, "txs_txs_put" },
+    { txs_layout_put, "txs_layout_put" },
 
     // services
     { not_found, "not_found" },
@@ -24,8 +24,11 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <ios>
+#include <iterator>
 #include <bitcoin/database/define.hpp>
 
 #if defined(HAVE_MSC) || defined(HAVE_LINUX)
@@ -180,6 +183,209 @@ code create_file_ex(const path& to, const uint8_t* data, size_t size) NOEXCEPT
     }
 }
 
+code create_file_ex(const path& to, const uint8_t* data, size_t size,
+    size_t chunk, const progress& handler) NOEXCEPT
+{
+    // Binary mode on Windows ensures that \n not replaced with \r\n.
+    try
+    {
+        // Throws.
+        ofstream file(to, std::ios_base::binary);
+
+        // Allow throw.
+        file.exceptions(std::ifstream::failbit);
+
+        // noexcept.
+        if (!file.good())
+            return system::error::errorno_t::not_a_stream;
+
+        // Writes at or above the stream buffer size bypass stream buffering.
+        const auto step = std::max(one, chunk);
+        for (size_t offset{}; offset < size;)
+        {
+            const auto bytes = std::min(step, size - offset);
+
+            // May throw.
+            file.write(pointer_cast<const char>(std::next(data, offset)),
+                bytes);
+
+            // noexcept.
+            if (!file.good())
+                return system::error::errorno_t::not_a_stream;
+
+            offset += bytes;
+            if (handler) handler(bytes);
+        }
+
+        // Sets failbit (but not noexcept).
+        file.close();
+
+        // noexcept.
+        return file.good() ?
+            system::error::errorno_t::no_error :
+            system::error::errorno_t::stream_timeout;
+    }
+    catch (const std::ios_base::failure& e)
+    {
+        // Prefer throw, since we get a platform code.
+        return e.code();
+    }
+}
+
+// Delta file: data size followed by (offset, size, bytes) spans, with sizes
+// and offsets little-endian 64 bit.
+code create_delta_ex(const path& to, const uint8_t* data, size_t size,
+    const spans& changes, const progress& handler) NOEXCEPT
+{
+    try
+    {
+        // Throws.
+        ofstream file(to, std::ios_base::binary);
+
+        // Allow throw.
+        file.exceptions(std::ifstream::failbit);
+
+        // noexcept.
+        if (!file.good())
+            return system::error::errorno_t::not_a_stream;
+
+        const auto put = [&](uint64_t value) NOEXCEPT
+        {
+            // May throw.
+            const auto bytes = to_little_endian(value);
+            file.write(pointer_cast<const char>(bytes.data()), bytes.size());
+        };
+
+        put(size);
+        for (const auto& [offset, bytes]: changes)
+        {
+            if (is_add_overflow(offset, bytes) || ((offset + bytes) > size))
+                return system::error::errorno_t::invalid_argument;
+
+            put(offset);
+            put(bytes);
+
+            // May throw.
+            file.write(pointer_cast<const char>(std::next(data, offset)),
+                bytes);
+
+            // noexcept.
+            if (!file.good())
+                return system::error::errorno_t::not_a_stream;
+
+            if (handler) handler(bytes);
+        }
+
+        // Sets failbit (but not noexcept).
+        file.close();
+
+        // noexcept.
+        return file.good() ?
+            system::error::errorno_t::no_error :
+            system::error::errorno_t::stream_timeout;
+    }
+    catch (const std::ios_base::failure& e)
+    {
+        // Prefer throw, since we get a platform code.
+        return e.code();
+    }
+}
+
+code apply_delta_ex(const path& to, const path& delta) NOEXCEPT
+{
+    constexpr size_t buffer_size = power2(20u);
+
+    try
+    {
+        // Throws.
+        ifstream source(delta, std::ios_base::binary);
+
+        // noexcept.
+        if (!source.good())
+            return system::error::errorno_t::not_a_stream;
+
+        const auto get = [&](uint64_t& value) NOEXCEPT
+        {
+            // May throw.
+            data_array<sizeof(uint64_t)> bytes{};
+            source.read(pointer_cast<char>(bytes.data()), bytes.size());
+            value = from_little_endian<uint64_t>(bytes);
+            return source.gcount() == to_signed(bytes.size());
+        };
+
+        uint64_t size{};
+        if (!get(size))
+            return system::error::errorno_t::invalid_argument;
+
+        // Spans are within size, so grow before writing (shrink after).
+        code ec{ system::error::errorno_t::no_error };
+        const auto prior = std::filesystem::file_size(extended_path(to), ec);
+        if (ec)
+            return ec;
+
+        const auto target_size = possible_narrow_cast<uintmax_t>(size);
+        if (target_size > prior)
+        {
+            std::filesystem::resize_file(extended_path(to), target_size, ec);
+            if (ec)
+                return ec;
+        }
+
+        // Throws.
+        std::fstream target(extended_path(to),
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+        // noexcept.
+        if (!target.good())
+            return system::error::errorno_t::not_a_stream;
+
+        uint64_t offset{};
+        data_chunk buffer(buffer_size);
+        while (get(offset))
+        {
+            uint64_t bytes{};
+            if (!get(bytes) || is_add_overflow(offset, bytes) ||
+                ((offset + bytes) > size))
+                return system::error::errorno_t::invalid_argument;
+
+            target.seekp(possible_narrow_and_sign_cast<std::streamoff>(offset));
+            while (is_nonzero(bytes))
+            {
+                const auto chunk = std::min(bytes, uint64_t{ buffer_size });
+                const auto count = possible_narrow_cast<size_t>(chunk);
+
+                // May throw.
+                source.read(pointer_cast<char>(buffer.data()), count);
+                if (source.gcount() != to_signed(count))
+                    return system::error::errorno_t::invalid_argument;
+
+                // May throw.
+                target.write(pointer_cast<const char>(buffer.data()), count);
+                if (!target.good())
+                    return system::error::errorno_t::not_a_stream;
+
+                bytes -= chunk;
+            }
+        }
+
+        // Truncated span header or stream failure (vs. end of spans).
+        if (!source.eof() || is_nonzero(source.gcount()))
+            return system::error::errorno_t::invalid_argument;
+
+        target.close();
+        if (target.fail())
+            return system::error::errorno_t::stream_timeout;
+
+        std::filesystem::resize_file(extended_path(to), target_size, ec);
+        return ec;
+    }
+    catch (const std::ios_base::failure& e)
+    {
+        // Prefer throw, since we get a platform code.
+        return e.code();
+    }
+}
+
 // directory|file
 bool remove(const path& name) NOEXCEPT
 {
@@ -17,8 +17,22 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/mstage.hpp>
 
@@ -35,12 +49,15 @@
     #include <sys/sysctl.h>
 #endif
 #if defined(HAVE_LINUX)
+    #include <linux/mempolicy.h>
     #include <sys/prctl.h>
+    #include <sys/syscall.h>
 #endif
 
 using namespace libbitcoin;
 using namespace libbitcoin::system;
 static constexpr auto transfer_chunk = power2(30u);
+static constexpr auto stripe_minimum = power2(22u);
 
 void* mmap_reserve(size_t size) NOEXCEPT
 {
@@ -48,11 +65,103 @@ void* mmap_reserve(size_t size) NOEXCEPT
         -1, 0);
 }
 
+// Over-reserve by the alignment and trim both ends, so the aligned base
+// places every align-granular offset on a huge page boundary (a huge page
+// backs only an aligned span wholly within one mapping).
+void* mmap_reserve(size_t size, size_t align) NOEXCEPT
+{
+    const auto extended = ceilinged_add(size, align);
+    const auto base = mmap_reserve(extended);
+    if (base == MAP_FAILED || is_zero(align))
+        return base;
+
+    const auto start = reinterpret_cast<uintptr_t>(base);
+    const auto lead = (align - (start % align)) % align;
+    const auto trail = extended - lead - size;
+    const auto aligned = std::next(pointer_cast<uint8_t>(base), lead);
+
+    if (!is_zero(lead))
+        ::munmap(base, lead);
+
+    if (!is_zero(trail))
+        ::munmap(std::next(aligned, size), trail);
+
+    return aligned;
+}
+
 int mmap_unreserve(void* address, size_t size) NOEXCEPT
 {
     return ::munmap(address, size);
 }
 
+#if defined(MADV_HUGEPAGE)
+int mmap_huge(void* address, size_t size) NOEXCEPT
+{
+    // The advice is a vma flag, retained as commitment splits the reserved
+    // mapping, so faults within aligned spans are served by huge pages.
+    return ::madvise(address, size, MADV_HUGEPAGE);
+}
+#else
+int mmap_huge(void*, size_t) NOEXCEPT
+{
+    return -1;
+}
+#endif
+
+// The policy is a vma property (as the huge page advice), retained as
+// commitment splits the reservation, so pages interleave as first touched.
+// Invoked as a raw system call (libnuma is not a dependency).
+#if defined(HAVE_LINUX) && defined(SYS_mbind) && defined(MPOL_INTERLEAVE)
+int mmap_interleave(void* address, size_t size) NOEXCEPT
+{
+    // Online nodes are listed as ranges (e.g. "0-1,3").
+    constexpr auto bits = to_bits(sizeof(unsigned long));
+    constexpr size_t limit = 1024;
+    std::vector<unsigned long> mask(limit / bits);
+    size_t nodes{};
+
+    const auto file = std::fopen("/sys/devices/system/node/online", "r");
+    if (is_null(file))
+        return -1;
+
+    unsigned first{};
+    unsigned last{};
+    int separator{};
+    while (std::fscanf(file, "%u", &first) == 1)
+    {
+        last = first;
+        if ((separator = std::fgetc(file)) == '-')
+        {
+            if (std::fscanf(file, "%u", &last) != 1)
+                break;
+
+            separator = std::fgetc(file);
+        }
+
+        for (auto node = first; (node <= last) && (node < limit); ++node)
+        {
+            mask.at(node / bits) |= (1ul << (node % bits));
+            ++nodes;
+        }
+
+        if (separator != ',')
+            break;
+    }
+
+    std::fclose(file);
+    if (nodes <= one)
+        return is_zero(nodes) ? -1 : 0;
+
+    return ::syscall(SYS_mbind, address, size, MPOL_INTERLEAVE, mask.data(),
+        limit + one, 0) == 0 ? 0 : -1;
+}
+#else
+int mmap_interleave(void*, size_t) NOEXCEPT
+{
+    return -1;
+}
+#endif
+
 #if defined(HAVE_APPLE)
 
 // Darwin admits every anonymous ask (exhaustion arrives at first touch), so
@@ -327,4 +436,226 @@ bool pwrite_all(int fd, const uint8_t* from, size_t size,
     return true;
 }
 
+// Queued transfers.
+// ----------------------------------------------------------------------------
+// A single synchronous caller holds one request in flight, which cannot
+// saturate an nvme device (or its page cache copy on a single core). These
+// issue independent positional requests from lanes of dedicated threads, as
+// a portable queue (an io_uring submission path requires a kernel interface
+// and library not assumed by the build). Lanes are not taken from the shared
+// pool, as its threads may be writers throttled on the caller (the settler).
+// Stripes are not reduced below the minimum, so small transfers remain one.
+
+using ranges = std::vector<std::pair<size_t, size_t>>;
+
+ranges to_stripes(size_t size, size_t depth) NOEXCEPT
+{
+    const auto count = std::clamp(size / stripe_minimum, one,
+        std::max(one, depth));
+    const auto stripe = ceilinged_divide(size, count);
+
+    ranges stripes{};
+    stripes.reserve(count);
+    for (size_t at{}; at < size; at += stripe)
+        stripes.emplace_back(at, std::min(stripe, size - at));
+
+    return stripes;
+}
+
+// Persistent lane threads, started on demand up to the deepest request and
+// shared by all stores. Lane tasks never wait on a caller, so a caller that
+// shares lanes with others is delayed but not blocked.
+class lane_pool
+{
+public:
+    using task = std::function<void()>;
+
+    DELETE_COPY_MOVE(lane_pool);
+
+    lane_pool() NOEXCEPT = default;
+
+    ~lane_pool() NOEXCEPT
+    {
+        {
+            std::unique_lock lock{ mutex_ };
+            stopped_ = true;
+        }
+
+        condition_.notify_all();
+        for (auto& thread: threads_)
+            thread.join();
+    }
+
+    // Queue task to count lanes, false if a lane thread could not be started
+    // (nothing is queued).
+    bool post(size_t count, const task& work) NOEXCEPT
+    {
+        if (is_zero(count))
+            return true;
+
+        {
+            std::unique_lock lock{ mutex_ };
+
+            try
+            {
+                while (threads_.size() < count)
+                    threads_.emplace_back(&lane_pool::run, this);
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+
+            for (size_t lane{}; lane < count; ++lane)
+                tasks_.push_back(work);
+        }
+
+        condition_.notify_all();
+        return true;
+    }
+
+private:
+    void run() NOEXCEPT
+    {
+        std::unique_lock lock{ mutex_ };
+        while (true)
+        {
+            condition_.wait(lock, [this]() NOEXCEPT
+            {
+                return stopped_ || !tasks_.empty();
+            });
+
+            if (tasks_.empty())
+                return;
+
+            const auto work = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            work();
+            lock.lock();
+        }
+    }
+
+    // These are protected by mutex_.
+    std::deque<task> tasks_{};
+    std::vector<std::thread> threads_{};
+    bool stopped_{};
+
+    std::mutex mutex_{};
+    std::condition_variable condition_{};
+};
+
+static lane_pool& lanes() NOEXCEPT
+{
+    static lane_pool instance{};
+    return instance;
+}
+
+// Requests are claimed in order by the caller and up to depth - 1 lanes. The
+// request is referenced only for a claimed index, and the caller returns only
+// once all claimed requests complete, so a lane task that starts late (lanes
+// busy with other callers) claims nothing and exits.
+struct lane_batch
+{
+    explicit lane_batch(size_t count) NOEXCEPT
+      : failed(count)
+    {
+    }
+
+    std::atomic<size_t> next{};
+    std::atomic<size_t> done{};
+    std::vector<std::atomic_bool> failed;
+};
+
+// Run each of count requests in one of up to depth lanes (caller is a lane),
+// returning the indexes of failed requests. Failure to start a lane thread is
+// an i/o failure of all requests (none are issued).
+template <typename Request>
+static std::vector<size_t> run_lanes(size_t count, size_t depth,
+    const Request& request) NOEXCEPT
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const auto lanes_count = std::clamp(depth, one, std::max(one, count));
+    const auto batch = std::make_shared<lane_batch>(count);
+
+    const auto lane = [batch, count, &request]() NOEXCEPT
+    {
+        auto index = batch->next.fetch_add(one, relaxed);
+        for (; index < count; index = batch->next.fetch_add(one, relaxed))
+        {
+            if (!request(index))
+                batch->failed.at(index).store(true, relaxed);
+
+            batch->done.fetch_add(one, std::memory_order_release);
+            batch->done.notify_all();
+        }
+    };
+
+    std::vector<size_t> out{};
+    if (!lanes().post(sub1(lanes_count), lane))
+    {
+        out.resize(count);
+        std::iota(out.begin(), out.end(), zero);
+        return out;
+    }
+
+    lane();
+    auto done = batch->done.load(std::memory_order_acquire);
+    while (done < count)
+    {
+        batch->done.wait(done, std::memory_order_acquire);
+        done = batch->done.load(std::memory_order_acquire);
+    }
+
+    for (size_t index{}; index < count; ++index)
+        if (batch->failed.at(index).load(relaxed))
+            out.push_back(index);
+
+    return out;
+}
+
+bool pread_all(int fd, uint8_t* to, size_t size, size_t offset,
+    size_t depth) NOEXCEPT
+{
+    const auto stripes = to_stripes(size, depth);
+    return run_lanes(stripes.size(), depth, [&](size_t index) NOEXCEPT
+    {
+        const auto& stripe = stripes.at(index);
+        return pread_all(fd, std::next(to, stripe.first), stripe.second,
+            offset + stripe.first);
+    }).empty();
+}
+
+bool pwrite_all(int fd, const uint8_t* from, size_t size, size_t offset,
+    size_t depth) NOEXCEPT
+{
+    const auto stripes = to_stripes(size, depth);
+    return run_lanes(stripes.size(), depth, [&](size_t index) NOEXCEPT
+    {
+        const auto& stripe = stripes.at(index);
+        return pwrite_all(fd, std::next(from, stripe.first), stripe.second,
+            offset + stripe.first);
+    }).empty();
+}
+
+bool pwrite_runs(int fd, const uint8_t* base, ranges& runs,
+    size_t depth) NOEXCEPT
+{
+    const auto failed = run_lanes(runs.size(), depth,
+        [&](size_t index) NOEXCEPT
+        {
+            const auto& run = runs.at(index);
+            return pwrite_all(fd, std::next(base, run.first), run.second,
+                run.first);
+        });
+
+    ranges retry{};
+    retry.reserve(failed.size());
+    for (const auto index: failed)
+        retry.push_back(runs.at(index));
+
+    runs = std::move(retry);
+    return runs.empty();
+}
+
 #endif // MANAGE_STAGING
@@ -31,6 +31,7 @@
     #include <algorithm>
     #include <cinttypes>
     #include <cstdio>
+    #include <cstring>
 #endif
 #include <bitcoin/database/define.hpp>
 
@@ -49,6 +50,12 @@ size_t page_size() NOEXCEPT
     return info.dwPageSize;
 }
 
+size_t huge_page_size() NOEXCEPT
+{
+    // Large pages require a lock privilege and cannot back a file view.
+    return zero;
+}
+
 uint64_t system_memory() NOEXCEPT
 {
     MEMORYSTATUSEX status{};
@@ -110,6 +117,45 @@ size_t page_size() NOEXCEPT
     return zero;
 }
 
+size_t huge_page_size() NOEXCEPT
+{
+#if defined(HAVE_LINUX)
+    // The policy brackets its selection, "[never]" disables madvise requests.
+    if (const auto file = std::fopen(
+        "/sys/kernel/mm/transparent_hugepage/enabled", "r"))
+    {
+        char line[128]{};
+        const auto read = !is_null(std::fgets(line, sizeof(line), file));
+        std::fclose(file);
+        if (!read || !is_null(std::strstr(line, "[never]")))
+            return zero;
+    }
+    else
+    {
+        return zero;
+    }
+
+    if (const auto file = std::fopen(
+        "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r"))
+    {
+        uint64_t bytes{};
+        const auto scanned = std::fscanf(file, "%" SCNu64, &bytes) == 1;
+        std::fclose(file);
+
+        // Must be a power of two multiple of the page size.
+        using namespace system;
+        const auto page = possible_wide_cast<uint64_t>(page_size());
+        if (scanned && !is_zero(page) && (bytes > page) &&
+            is_one(ones_count(bytes)) && !is_limited<size_t>(bytes))
+            return possible_narrow_cast<size_t>(bytes);
+    }
+#endif
+
+    // Failed, disabled or no platform source (darwin superpages cannot back
+    // the reserve/commit model).
+    return zero;
+}
+
 uint64_t system_memory() NOEXCEPT
 {
     errno = 0;
@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/block_stream.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+using namespace system;
+
+block_stream::block_stream(memory_getter&& memory, tx_links&& txs,
+    const header_bytes& header, bool witness) NOEXCEPT
+  : get_memory_(std::move(memory)),
+    txs_(std::move(txs)),
+    header_(header),
+    witness_(witness),
+    step_(get_memory_ && !txs_.empty() ? step::header : step::done),
+    fault_(!get_memory_ || txs_.empty())
+{
+}
+
+bool block_stream::done() const NOEXCEPT
+{
+    return step_ == step::done && offset_ == piece_.size();
+}
+
+bool block_stream::fault() const NOEXCEPT
+{
+    return fault_;
+}
+
+size_t block_stream::read(const data_slab& buffer) NOEXCEPT
+{
+    if (!acquire())
+        return zero;
+
+    size_t count{};
+    while (count < buffer.size())
+    {
+        if (offset_ == piece_.size())
+        {
+            if (!next())
+                break;
+
+            continue;
+        }
+
+        const auto bytes = std::min(piece_.size() - offset_,
+            buffer.size() - count);
+        std::copy_n(std::next(piece_.data(), offset_), bytes,
+            std::next(buffer.data(), count));
+        offset_ += bytes;
+        count += bytes;
+    }
+
+    release();
+    return count;
+}
+
+size_t block_stream::gather(slices& out, size_t limit) NOEXCEPT
+{
+    out.clear();
+    if (!acquire())
+        return zero;
+
+    size_t used{};
+    size_t count{};
+    while (count < limit)
+    {
+        if (offset_ == piece_.size())
+        {
+            if (!next())
+                break;
+
+            continue;
+        }
+
+        auto bytes = std::min(piece_.size() - offset_, limit - count);
+        auto from = std::next(piece_.data(), offset_);
+
+        // Generated bytes are staged in the arena, as pending is overwritten.
+        if (piece_.data() == pending_.data())
+        {
+            bytes = std::min(bytes, arena_size - used);
+            if (is_zero(bytes))
+                break;
+
+            const auto staged = std::next(arena_.data(), used);
+            std::copy_n(from, bytes, staged);
+            from = staged;
+            used += bytes;
+        }
+
+        // Contiguous bytes are merged into the preceding slice.
+        const auto to = std::next(from, bytes);
+        if (!out.empty() && out.back().end() == from)
+            out.back() = { out.back().begin(), to };
+        else
+            out.emplace_back(from, to);
+
+        offset_ += bytes;
+        count += bytes;
+    }
+
+    return count;
+}
+
+void block_stream::release() NOEXCEPT
+{
+    memory_ = {};
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+template <typename Writer>
+void block_stream::generate(const Writer& writer) NOEXCEPT
+{
+    const data_slab slab{ pending_.data(), std::next(pending_.data(),
+        pending_size) };
+    stream::flip::fast ostream(slab);
+    flip::bytes::fast sink(ostream);
+    writer(sink);
+    BC_ASSERT(sink);
+
+    piece_ = { pending_.data(), std::next(pending_.data(),
+        sink.get_write_position()) };
+}
+
+// Memory held by a prior gather is released before it is obtained again.
+bool block_stream::acquire() NOEXCEPT
+{
+    release();
+    if (done())
+        return false;
+
+    // std::function does not allow for noexcept.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    memory_ = get_memory_();
+    BC_POP_WARNING()
+
+    if (!memory_)
+        return failed();
+
+    return resume();
+}
+
+// A partially yielded mapped piece is sliced again from current memory, as
+// the table may have been remapped since the call that sliced it.
+bool block_stream::resume() NOEXCEPT
+{
+    if (offset_ == piece_.size())
+        return true;
+
+    switch (mapped_)
+    {
+        case step::script:
+        {
+            if (!tx_->get_input(input_, index_))
+                return failed();
+
+            piece_ = input_.script;
+            return true;
+        }
+        case step::output_script:
+        {
+            if (!tx_->get_output(output_, sub1(index_)))
+                return failed();
+
+            piece_ = output_.script;
+            return true;
+        }
+        case step::witness:
+        {
+            if (!tx_->get_input(input_, sub1(index_)))
+                return failed();
+
+            piece_ = input_.witness;
+            return true;
+        }
+        default:
+        {
+            return true;
+        }
+    }
+}
+
+bool block_stream::failed() NOEXCEPT
+{
+    fault_ = true;
+    step_ = step::done;
+    piece_ = {};
+    offset_ = zero;
+    return false;
+}
+
+// Set the next piece (possibly empty), false if done. Each stored input is
+// read twice (with the witness read deferred to wire order), but the second
+// is pointer arithmetic over rows that were just paged in by the first.
+bool block_stream::next() NOEXCEPT
+{
+    offset_ = zero;
+    mapped_ = step::done;
+    switch (step_)
+    {
+        case step::header:
+        {
+            piece_ = { header_.data(), std::next(header_.data(),
+                header_.size()) };
+            step_ = step::count;
+            return true;
+        }
+        case step::count:
+        {
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_variable(txs_.size());
+            });
+
+            step_ = step::transaction;
+            return true;
+        }
+        case step::transaction:
+        {
+            if (position_ == txs_.size())
+            {
+                step_ = step::done;
+                piece_ = {};
+                return false;
+            }
+
+            tx_.emplace(memory_, txs_.at(position_));
+            if (!(*tx_))
+                return failed();
+
+            const auto& tx = *tx_;
+            witnessed_ = witness_ && (tx.heavy() != tx.light());
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_4_bytes_little_endian(tx.version());
+                if (witnessed_)
+                {
+                    sink.write_byte(chain::witness_marker);
+                    sink.write_byte(chain::witness_enabled);
+                }
+
+                sink.write_variable(tx.inputs());
+            });
+
+            index_ = zero;
+            step_ = step::input;
+            return true;
+        }
+        case step::input:
+        {
+            const auto& tx = *tx_;
+            if (index_ == tx.inputs())
+            {
+                generate([&](auto& sink) NOEXCEPT
+                {
+                    sink.write_variable(tx.outputs());
+                });
+
+                index_ = zero;
+                step_ = step::output;
+                return true;
+            }
+
+            if (!tx.get_input(input_, index_))
+                return failed();
+
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_bytes(input_.hash);
+                sink.write_4_bytes_little_endian(input_.index);
+                sink.write_variable(input_.script.size());
+            });
+
+            step_ = step::script;
+            return true;
+        }
+        case step::script:
+        {
+            piece_ = input_.script;
+            mapped_ = step::script;
+            step_ = step::sequence;
+            return true;
+        }
+        case step::sequence:
+        {
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_4_bytes_little_endian(input_.sequence);
+            });
+
+            ++index_;
+            step_ = step::input;
+            return true;
+        }
+        case step::output:
+        {
+            const auto& tx = *tx_;
+            if (index_ == tx.outputs())
+            {
+                index_ = zero;
+                step_ = witnessed_ ? step::witness : step::locktime;
+                return next();
+            }
+
+            if (!tx.get_output(output_, index_))
+                return failed();
+
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_8_bytes_little_endian(output_.value);
+                sink.write_variable(output_.script.size());
+            });
+
+            step_ = step::output_script;
+            return true;
+        }
+        case step::output_script:
+        {
+            piece_ = output_.script;
+            mapped_ = step::output_script;
+            ++index_;
+            step_ = step::output;
+            return true;
+        }
+        case step::witness:
+        {
+            const auto& tx = *tx_;
+            if (index_ == tx.inputs())
+            {
+                step_ = step::locktime;
+                return next();
+            }
+
+            if (!tx.get_input(input_, index_))
+                return failed();
+
+            piece_ = input_.witness;
+            mapped_ = step::witness;
+            ++index_;
+            return true;
+        }
+        case step::locktime:
+        {
+            generate([&](auto& sink) NOEXCEPT
+            {
+                sink.write_4_bytes_little_endian(tx_->locktime());
+            });
+
+            ++position_;
+            step_ = position_ == txs_.size() ? step::done :
+                step::transaction;
+            return true;
+        }
+        case step::done:
+        default:
+        {
+            piece_ = {};
+            return false;
+        }
+    }
+}
+
+} // namespace database
+} // namespace libbitcoin
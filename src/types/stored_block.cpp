@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/stored_block.hpp>
+
+#include <utility>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// stored_transaction
+// ----------------------------------------------------------------------------
+
+stored_transaction::stored_transaction(const archive_memory& memory,
+    const tx_link& link) NOEXCEPT
+  : memory_(memory),
+    valid_(memory && table::transaction::get(memory.tx, link, tx_))
+{
+}
+
+stored_transaction::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+const system::hash_digest& stored_transaction::hash() const NOEXCEPT
+{
+    return tx_.key;
+}
+
+uint32_t stored_transaction::version() const NOEXCEPT
+{
+    return tx_.version;
+}
+
+uint32_t stored_transaction::locktime() const NOEXCEPT
+{
+    return tx_.locktime;
+}
+
+bool stored_transaction::is_coinbase() const NOEXCEPT
+{
+    return tx_.coinbase;
+}
+
+size_t stored_transaction::inputs() const NOEXCEPT
+{
+    return tx_.ins_count;
+}
+
+size_t stored_transaction::outputs() const NOEXCEPT
+{
+    return tx_.outs_count;
+}
+
+size_t stored_transaction::light() const NOEXCEPT
+{
+    return tx_.light;
+}
+
+size_t stored_transaction::heavy() const NOEXCEPT
+{
+    return tx_.heavy;
+}
+
+bool stored_transaction::get_input(stored_input& out,
+    size_t index) const NOEXCEPT
+{
+    if (!valid_ || index >= inputs())
+        return false;
+
+    // Points are allocated contiguously.
+    const ins_link link{ system::possible_narrow_cast<ins_link::integer>(
+        tx_.point_fk + index) };
+
+    table::ins_point::record point{};
+    table::ins_sequence::get_input ins{};
+    table::input::get_slices in{};
+    if (!table::ins::get(memory_.ins, link, point) ||
+        !table::ins::get<one>(memory_.sequence, link, ins) ||
+        !table::input::raw(memory_.input, ins.input_fk, in))
+        return false;
+
+    out.hash = point.hash;
+    out.index = point.index;
+    out.sequence = ins.sequence;
+    out.script = in.script;
+    out.witness = in.witness;
+    return true;
+}
+
+bool stored_transaction::get_output(stored_output& out,
+    size_t index) const NOEXCEPT
+{
+    if (!valid_ || index >= outputs())
+        return false;
+
+    // Output fks are allocated contiguously.
+    const outs_link link{ system::possible_narrow_cast<outs_link::integer>(
+        tx_.outs_fk + index) };
+
+    table::outs::get_output outs{};
+    table::output::get_slices output{};
+    if (!table::outs::get<one>(memory_.puts, link, outs) ||
+        !table::output::raw(memory_.output, outs.out_fk, output))
+        return false;
+
+    out.value = output.value;
+    out.script = output.script;
+    return true;
+}
+
+// stored_block
+// ----------------------------------------------------------------------------
+
+stored_block::stored_block() NOEXCEPT
+{
+}
+
+stored_block::stored_block(archive_memory&& memory, tx_links&& txs) NOEXCEPT
+  : memory_(std::move(memory)), txs_(std::move(txs))
+{
+}
+
+stored_block::operator bool() const NOEXCEPT
+{
+    return memory_ && !txs_.empty();
+}
+
+size_t stored_block::transactions() const NOEXCEPT
+{
+    return txs_.size();
+}
+
+stored_transaction stored_block::transaction(size_t position) const NOEXCEPT
+{
+    if (position >= txs_.size())
+        return { memory_, tx_link{} };
+
+    return { memory_, txs_.at(position) };
+}
+
+void stored_block::reset() NOEXCEPT
+{
+    memory_.tx.reset();
+    memory_.ins.reset();
+    memory_.sequence.reset();
+    memory_.puts.reset();
+    memory_.input.reset();
+    memory_.output.reset();
+}
+
+} // namespace database
+} // namespace libbitcoin
@@ -423,6 +423,24 @@ BOOST_AUTO_TEST_CASE(error_t__code__unloaded_file__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "file not loaded");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__untracked_file__true_expected_message)
+{
+    constexpr auto value = error::untracked_file;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "file changes not tracked");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__invalid_delta__true_expected_message)
+{
+    constexpr auto value = error::invalid_delta;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid snapshot delta");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__create_table__true_expected_message)
 {
     constexpr auto value = error::create_table;
@@ -477,6 +495,42 @@ BOOST_AUTO_TEST_CASE(error_t__code__verify_table__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "failed to verify table");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__rehash_table__true_expected_message)
+{
+    constexpr auto value = error::rehash_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "failed to rehash table");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__strong_mode__true_expected_message)
+{
+    constexpr auto value = error::strong_mode;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "strong index does not match dense_strong setting");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__unbuilt_table__true_expected_message)
+{
+    constexpr auto value = error::unbuilt_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "table cannot be enabled on an existing store");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__fingerprint_width__true_expected_message)
+{
+    constexpr auto value = error::fingerprint_width;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "address fingerprint does not match store");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__tx_connected__true_expected_message)
 {
     constexpr auto value = error::tx_connected;
@@ -735,6 +789,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__txs_txs_put__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "txs_txs_put");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__txs_layout_put__true_expected_message)
+{
+    constexpr auto value = error::txs_layout_put;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "txs_layout_put");
+}
+
 // services
 
 BOOST_AUTO_TEST_CASE(error_t__code__not_found__true_expected_message)
@@ -132,6 +132,50 @@ BOOST_AUTO_TEST_CASE(file_utilities__create_file__missing__expected_size)
     BOOST_REQUIRE(file::close(descriptor));
 }
 
+BOOST_AUTO_TEST_CASE(file_utilities__create_file_ex__chunked__expected_size_progress)
+{
+    size_t calls{};
+    size_t bytes{};
+    const data_chunk source(42u);
+    BOOST_REQUIRE(!file::create_file_ex(TEST_PATH, source.data(), source.size(),
+        10u, [&](size_t written) NOEXCEPT { ++calls; bytes += written; }));
+    BOOST_REQUIRE_EQUAL(calls, 5u);
+    BOOST_REQUIRE_EQUAL(bytes, source.size());
+
+    size_t out{};
+    BOOST_REQUIRE(file::size(out, TEST_PATH));
+    BOOST_REQUIRE_EQUAL(out, source.size());
+}
+
+BOOST_AUTO_TEST_CASE(file_utilities__apply_delta_ex__created_delta__applied)
+{
+    const auto delta = TEST_PATH + ".delta";
+    const data_chunk base(100u, 0x00);
+    data_chunk source(120u, 0x00);
+    source.at(10) = 0x42;
+    source.at(110) = 0x24;
+    const file::spans changes{ { 10u, 1u }, { 100u, 20u } };
+    BOOST_REQUIRE(file::create_file(TEST_PATH, base.data(), base.size()));
+    BOOST_REQUIRE(!file::create_delta_ex(delta, source.data(), source.size(),
+        changes, {}));
+    BOOST_REQUIRE(!file::apply_delta_ex(TEST_PATH, delta));
+
+    size_t out{};
+    BOOST_REQUIRE(file::size(out, TEST_PATH));
+    BOOST_REQUIRE_EQUAL(out, source.size());
+    BOOST_REQUIRE_EQUAL(test::read_line(TEST_PATH), std::string(
+        source.begin(), source.end()));
+}
+
+BOOST_AUTO_TEST_CASE(file_utilities__apply_delta_ex__truncated_delta__error)
+{
+    const auto delta = TEST_PATH + ".delta";
+    const data_chunk base(100u, 0x00);
+    BOOST_REQUIRE(file::create_file(TEST_PATH, base.data(), base.size()));
+    BOOST_REQUIRE(file::create_file(delta, base.data(), 12u));
+    BOOST_REQUIRE(file::apply_delta_ex(TEST_PATH, delta));
+}
+
 BOOST_AUTO_TEST_CASE(file_utilities__create_file__exists__replaced)
 {
     const data_chunk old(100);
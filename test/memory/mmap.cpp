@@ -303,6 +303,47 @@ BOOST_AUTO_TEST_CASE(mmap__allocate__loaded__expected_capacity)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(mmap__willneed__unloaded__false)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.willneed(zero, one));
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__willneed__loaded__expected)
+{
+    constexpr auto size = 100_size;
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(size), zero);
+
+    // Empty ranges, ranges beyond logical and invalid columns are not advised.
+    BOOST_REQUIRE(!instance.willneed(zero, zero));
+    BOOST_REQUIRE(!instance.willneed(size, one));
+    BOOST_REQUIRE(!instance.willneed(zero, one, one));
+
+#if !defined(HAVE_MSC) && !defined(WITHOUT_MADVISE)
+    // Unaligned offsets are floored to page and sizes clamped to logical.
+    BOOST_REQUIRE(instance.willneed(zero, size));
+    BOOST_REQUIRE(instance.willneed(sub1(size), size));
+#else
+    BOOST_REQUIRE(!instance.willneed(zero, size));
+#endif
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(mmap__allocate__add_overflow__eof)
 {
     const std::string file = TEST_PATH;
@@ -923,6 +964,29 @@ BOOST_AUTO_TEST_CASE(mmap__flush__loaded__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(mmap__flush__loaded__durations_counted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE_EQUAL(instance.flush(), error::flush_unloaded);
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_NE(instance.allocate(42), storage::eof);
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE(!instance.flush());
+
+    // Failed flushes are not timed.
+    const auto durations = instance.stats().flush_durations;
+    BOOST_REQUIRE_EQUAL(std::accumulate(durations.begin(), durations.end(),
+        zero), two);
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(mmap__write__read__expected)
 {
     constexpr uint64_t expected = 0x0102030405060708_u64;
@@ -1148,8 +1212,131 @@ BOOST_AUTO_TEST_CASE(mmap__frontier__staged_truncate__discards_extents)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(mmap__stats__staged_open_extent__lag_and_debt)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, { 1, 50 }, true, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+
+    const auto first = instance.allocate(100);
+    instance.complete(first, 100);
+    const auto second = instance.allocate(50);
+
+    // The open extent pins the frontier, lag is its size, debt at least that.
+    const auto stats = instance.stats();
+    BOOST_REQUIRE_EQUAL(stats.logical, instance.size());
+    BOOST_REQUIRE_EQUAL(stats.frontier, second);
+    BOOST_REQUIRE_EQUAL(stats.lag, 50u);
+    BOOST_REQUIRE_GE(stats.debt, stats.lag);
+    BOOST_REQUIRE_GE(stats.window, one);
+    BOOST_REQUIRE_EQUAL(stats.faults, zero);
+
+    instance.complete(second, 50);
+    BOOST_REQUIRE_EQUAL(instance.stats().lag, zero);
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 #endif // MANAGE_STAGING
 
+BOOST_AUTO_TEST_CASE(mmap__stats__unstaged_growth__counts_remaps)
+{
+    constexpr auto minimum = 42_size;
+    constexpr auto rate = 50_size;
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, { minimum, rate });
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    const auto remaps = instance.stats().remaps;
+    BOOST_REQUIRE_EQUAL(instance.allocate(1000), zero);
+
+    // Unstaged frontier and settled track logical, growth remaps.
+    const auto stats = instance.stats();
+    BOOST_REQUIRE_EQUAL(stats.logical, 1000u);
+    BOOST_REQUIRE_EQUAL(stats.frontier, stats.logical);
+    BOOST_REQUIRE_EQUAL(stats.settled, stats.logical);
+    BOOST_REQUIRE_EQUAL(stats.lag, zero);
+    BOOST_REQUIRE_EQUAL(stats.debt, zero);
+    BOOST_REQUIRE_GT(stats.remaps, remaps);
+    BOOST_REQUIRE_EQUAL(stats.faults, zero);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__huge__staged_flush_reload__expected)
+{
+    constexpr auto size = 3_size * system::power2(20u);
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    // Falls back to base pages where huge pages are unavailable.
+    map instance(file, { 1, 50, 0, advice::scattered, true }, false, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(size), zero);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    for (size_t byte{}; byte < size; ++byte)
+        memory.begin()[byte] = system::possible_narrow_cast<uint8_t>(byte);
+
+    memory.reset();
+    instance.complete(zero, size);
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.load());
+
+    memory = instance.get();
+    BOOST_REQUIRE(memory);
+    auto expected = true;
+    for (size_t byte{}; byte < size; ++byte)
+        expected &= (memory.begin()[byte] ==
+            system::possible_narrow_cast<uint8_t>(byte));
+
+    BOOST_REQUIRE(expected);
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__interleave__unstaged_flush_reload__expected)
+{
+    constexpr uint64_t expected = 0x0102030405060708_u64;
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    // Placement only, so single node and unsupported platforms are unaffected.
+    map instance(file, { 1, 50, 0, advice::random, false, true }, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+
+    auto memory = instance.get(instance.allocate(sizeof(uint64_t)));
+    BOOST_REQUIRE(memory);
+    system::unsafe_to_little_endian<uint64_t>(memory.begin(), expected);
+    memory.reset();
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.load());
+
+    memory = instance.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(system::unsafe_from_little_endian<uint64_t>(
+        memory.begin()), expected);
+
+    memory.reset();
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(mmap__unstaged__rewrite_below_flush__expected)
 {
     constexpr size_t size = 10'000;
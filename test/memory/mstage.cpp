@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "../test.hpp"
+
+#if defined(MANAGE_STAGING)
+
+BOOST_FIXTURE_TEST_SUITE(mstage_tests, test::directory_setup_fixture)
+
+constexpr auto minimum = system::power2(22u);
+using ranges = std::vector<std::pair<size_t, size_t>>;
+
+static data_chunk make_data(size_t size) NOEXCEPT
+{
+    data_chunk out(size);
+    for (size_t index{}; index < size; ++index)
+        out.at(index) = system::possible_narrow_cast<uint8_t>(index % 251u);
+
+    return out;
+}
+
+// to_stripes
+
+BOOST_AUTO_TEST_CASE(mstage__to_stripes__empty__empty)
+{
+    BOOST_REQUIRE(to_stripes(0, 4).empty());
+}
+
+BOOST_AUTO_TEST_CASE(mstage__to_stripes__below_minimum__one)
+{
+    BOOST_REQUIRE(to_stripes(42, 4) == ranges({ { 0, 42 } }));
+    BOOST_REQUIRE(to_stripes(sub1(2u * minimum), 4) == ranges({ { 0, sub1(2u * minimum) } }));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__to_stripes__zero_depth__one)
+{
+    BOOST_REQUIRE(to_stripes(4u * minimum, 0) == ranges({ { 0, 4u * minimum } }));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__to_stripes__depth_limited__depth)
+{
+    const ranges expected{ { 0, 2u * minimum }, { 2u * minimum, 2u * minimum } };
+    BOOST_REQUIRE(to_stripes(4u * minimum, 2) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(mstage__to_stripes__minimum_limited__minimum_stripes)
+{
+    const auto stripes = to_stripes(4u * minimum + 1u, 8);
+    BOOST_REQUIRE_EQUAL(stripes.size(), 4u);
+
+    // Contiguous, covering and ceilinged (last is short).
+    size_t at{};
+    for (const auto& stripe: stripes)
+    {
+        BOOST_REQUIRE_EQUAL(stripe.first, at);
+        at += stripe.second;
+    }
+
+    BOOST_REQUIRE_EQUAL(at, 4u * minimum + 1u);
+    BOOST_REQUIRE_EQUAL(stripes.front().second, minimum + 1u);
+    BOOST_REQUIRE_EQUAL(stripes.back().second, minimum - 2u);
+}
+
+// pread_all/pwrite_all (depth)
+
+BOOST_AUTO_TEST_CASE(mstage__pwrite_all__striped__pread_all_striped_expected)
+{
+    const std::string file = TEST_PATH;
+    const auto size = 3u * minimum + 42u;
+    const auto expected = make_data(size);
+    BOOST_REQUIRE(!file::create_file_ex(file, data_chunk(size).data(), size));
+
+    const auto descriptor = file::open(file);
+    BOOST_REQUIRE_NE(descriptor, -1);
+    BOOST_REQUIRE(pwrite_all(descriptor, expected.data(), size, zero, 4));
+
+    data_chunk out(size);
+    BOOST_REQUIRE(pread_all(descriptor, out.data(), size, zero, 4));
+    BOOST_REQUIRE(out == expected);
+
+    // Unstriped read of striped write.
+    data_chunk serial(size);
+    BOOST_REQUIRE(pread_all(descriptor, serial.data(), size, zero));
+    BOOST_REQUIRE(serial == expected);
+    BOOST_REQUIRE(file::close(descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pwrite_all__depth_exceeds_stripes__expected)
+{
+    const std::string file = TEST_PATH;
+    const auto size = 2u * minimum;
+    const auto expected = make_data(size);
+    BOOST_REQUIRE(!file::create_file_ex(file, data_chunk(size).data(), size));
+
+    const auto descriptor = file::open(file);
+    BOOST_REQUIRE_NE(descriptor, -1);
+    BOOST_REQUIRE(pwrite_all(descriptor, expected.data(), size, zero, 64));
+
+    data_chunk out(size);
+    BOOST_REQUIRE(pread_all(descriptor, out.data(), size, zero, 64));
+    BOOST_REQUIRE(out == expected);
+    BOOST_REQUIRE(file::close(descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pread_all__offset__expected)
+{
+    const std::string file = TEST_PATH;
+    const auto size = 2u * minimum;
+    const auto expected = make_data(size);
+    BOOST_REQUIRE(!file::create_file_ex(file, expected.data(), size));
+
+    const auto descriptor = file::open(file);
+    BOOST_REQUIRE_NE(descriptor, -1);
+
+    data_chunk out(minimum);
+    BOOST_REQUIRE(pread_all(descriptor, out.data(), minimum, minimum, 2));
+    BOOST_REQUIRE(std::equal(out.begin(), out.end(), std::next(expected.begin(), minimum)));
+    BOOST_REQUIRE(file::close(descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pread_all__empty__true)
+{
+    BOOST_REQUIRE(pread_all(-1, nullptr, zero, zero, 4));
+    BOOST_REQUIRE(pwrite_all(-1, nullptr, zero, zero, 4));
+}
+
+// Early eof of the last stripe fails the read (other stripes are read).
+BOOST_AUTO_TEST_CASE(mstage__pread_all__short_file__false)
+{
+    const std::string file = TEST_PATH;
+    const auto size = 4u * minimum;
+    const auto expected = make_data(size);
+    BOOST_REQUIRE(!file::create_file_ex(file, expected.data(), size));
+
+    const auto descriptor = file::open(file);
+    BOOST_REQUIRE_NE(descriptor, -1);
+
+    data_chunk out(add1(size));
+    BOOST_REQUIRE(!pread_all(descriptor, out.data(), add1(size), zero, 4));
+    BOOST_REQUIRE(!pread_all(descriptor, out.data(), minimum, size, 4));
+    BOOST_REQUIRE(std::equal(expected.begin(), std::next(expected.begin(), minimum), out.begin()));
+    BOOST_REQUIRE(file::close(descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pread_all__invalid_descriptor__false)
+{
+    data_chunk out(2u * minimum);
+    BOOST_REQUIRE(!pread_all(-1, out.data(), out.size(), zero, 2));
+    BOOST_REQUIRE(!pwrite_all(-1, out.data(), out.size(), zero, 2));
+}
+
+// pwrite_runs
+
+BOOST_AUTO_TEST_CASE(mstage__pwrite_runs__runs__written_emptied)
+{
+    const std::string file = TEST_PATH;
+    const auto size = 64u * 1024u;
+    const auto expected = make_data(size);
+    BOOST_REQUIRE(!file::create_file_ex(file, data_chunk(size).data(), size));
+
+    const auto descriptor = file::open(file);
+    BOOST_REQUIRE_NE(descriptor, -1);
+
+    // Disjoint runs, including more runs than depth.
+    ranges runs{ { 0, 100 }, { 4096, 8192 }, { 20000, 1 }, { 30000, 34000 }, { 65535, 1 } };
+    BOOST_REQUIRE(pwrite_runs(descriptor, expected.data(), runs, 2));
+    BOOST_REQUIRE(runs.empty());
+
+    data_chunk out(size);
+    BOOST_REQUIRE(pread_all(descriptor, out.data(), size, zero));
+    for (const auto& run: ranges{ { 0, 100 }, { 4096, 8192 }, { 20000, 1 }, { 30000, 34000 }, { 65535, 1 } })
+    {
+        const auto first = std::next(out.begin(), run.first);
+        BOOST_REQUIRE(std::equal(first, std::next(first, run.second), std::next(expected.begin(), run.first)));
+    }
+
+    // Unwritten bytes remain zeroed.
+    BOOST_REQUIRE_EQUAL(out.at(100), 0u);
+    BOOST_REQUIRE_EQUAL(out.at(20001), 0u);
+    BOOST_REQUIRE(file::close(descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pwrite_runs__no_runs__true)
+{
+    ranges runs{};
+    BOOST_REQUIRE(pwrite_runs(-1, nullptr, runs, 4));
+    BOOST_REQUIRE(runs.empty());
+}
+
+BOOST_AUTO_TEST_CASE(mstage__pwrite_runs__invalid_descriptor__false_all_retained)
+{
+    const auto base = make_data(1024);
+    const ranges expected{ { 0, 10 }, { 100, 10 }, { 200, 10 } };
+    auto runs = expected;
+    BOOST_REQUIRE(!pwrite_runs(-1, base.data(), runs, 2));
+    BOOST_REQUIRE(runs == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // MANAGE_STAGING
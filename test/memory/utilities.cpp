@@ -27,6 +27,14 @@ BOOST_AUTO_TEST_CASE(memory_utilities__page_size__always__non_zero)
     BOOST_REQUIRE(is_nonzero(page_size()));
 }
 
+// Huge pages are optional (zero), otherwise a power of two page multiple.
+BOOST_AUTO_TEST_CASE(memory_utilities__huge_page_size__always__zero_or_page_multiple)
+{
+    const auto huge = huge_page_size();
+    BOOST_REQUIRE(is_zero(huge) || (huge > page_size()));
+    BOOST_REQUIRE(is_zero(huge) || is_zero(huge % page_size()));
+}
+
 // It is not possible for the actual memory to be zero and an overflow will
 // return max_uint64, so this test should never fail on any platform, though
 // an API failure returns zero.
@@ -151,6 +151,11 @@ public:
         return error::success;
     }
 
+    code dump(const path&, const progress&) const NOEXCEPT override
+    {
+        return error::success;
+    }
+
     const path& file() const NOEXCEPT override
     {
         return paths_[0];
@@ -135,6 +135,16 @@ public:
         return strong_tx_body_.buffer();
     }
 
+    system::data_chunk& strong_array_head() NOEXCEPT
+    {
+        return strong_array_head_.buffer();
+    }
+
+    system::data_chunk& strong_array_body() NOEXCEPT
+    {
+        return strong_array_body_.buffer();
+    }
+
     // Caches.
 
     system::data_chunk& ecdsa_head() NOEXCEPT
@@ -278,6 +288,26 @@ public:
     {
         return filter_tx_body_.buffer();
     }
+
+    system::data_chunk& summary_head() NOEXCEPT
+    {
+        return summary_head_.buffer();
+    }
+
+    system::data_chunk& summary_body() NOEXCEPT
+    {
+        return summary_body_.buffer();
+    }
+
+    system::data_chunk& layout_head() NOEXCEPT
+    {
+        return layout_head_.buffer();
+    }
+
+    system::data_chunk& layout_body() NOEXCEPT
+    {
+        return layout_body_.buffer();
+    }
 };
 
 using query_accessor = query<store<chunk_storages>>;
@@ -159,6 +159,16 @@ public:
         return strong_tx_body_.file();
     }
 
+    inline const path& strong_array_head_file() const NOEXCEPT
+    {
+        return strong_array_head_.file();
+    }
+
+    inline const path& strong_array_body_file() const NOEXCEPT
+    {
+        return strong_array_body_.file();
+    }
+
     // Caches.
 
     inline const path& ecdsa_head_file() const NOEXCEPT
@@ -303,6 +313,26 @@ public:
         return filter_tx_body_.file();
     }
 
+    inline const path& summary_head_file() const NOEXCEPT
+    {
+        return summary_head_.file();
+    }
+
+    inline const path& summary_body_file() const NOEXCEPT
+    {
+        return summary_body_.file();
+    }
+
+    inline const path& layout_head_file() const NOEXCEPT
+    {
+        return layout_head_.file();
+    }
+
+    inline const path& layout_body_file() const NOEXCEPT
+    {
+        return layout_body_.file();
+    }
+
     // Locks.
 
     inline const path& flush_lock_file() const NOEXCEPT
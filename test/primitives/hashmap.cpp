@@ -638,6 +638,74 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_first__exists__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(hashmap__record_first_many__empty__empty)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    std::vector<key1> keys{};
+    std::vector<link5> found{};
+    instance.first_many(keys, found);
+    BOOST_REQUIRE(instance.exists_many(keys).empty());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__record_first_many__multiple_groups__same_as_first)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    // Even keys are present, conflict lists are longer than one (16 buckets).
+    std::vector<key1> keys{};
+    for (auto value = 0_u8; value < 100u; ++value)
+    {
+        keys.push_back(key1{ value });
+        if (is_even(value))
+            BOOST_REQUIRE(!instance.put_link(keys.back(), big_record{ value }).is_terminal());
+    }
+
+    // Keys span several prefetch groups, and include a partial last group.
+    std::vector<link5> found(keys.size());
+    instance.first_many(keys, found);
+    const auto exists = instance.exists_many(keys);
+    BOOST_REQUIRE_EQUAL(exists.size(), keys.size());
+
+    for (size_t index{}; index < keys.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(found.at(index), instance.first(keys.at(index)));
+        BOOST_REQUIRE_EQUAL(exists.at(index), is_even(index));
+    }
+
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__slab_exists_many__duplicates__newest)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_slab::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    constexpr key1 key{ 0x41 };
+    constexpr key1 absent{ 0x42 };
+    BOOST_REQUIRE(!instance.put_link(key, big_slab{ 0x01 }).is_terminal());
+    const auto newest = instance.put_link(key, big_slab{ 0x02 });
+    BOOST_REQUIRE(!newest.is_terminal());
+
+    const std::vector<key1> keys{ key, absent, key };
+    std::vector<link5> found(keys.size());
+    instance.first_many(keys, found);
+    BOOST_REQUIRE_EQUAL(found.at(0), newest);
+    BOOST_REQUIRE(found.at(1).is_terminal());
+    BOOST_REQUIRE_EQUAL(found.at(2), newest);
+    BOOST_REQUIRE(instance.exists_many(keys) == std::vector<bool>({ true, false, true }));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(hashmap__record_it__exists_copy__non_terminal)
 {
     test::chunk_storage head_store{};
@@ -793,6 +861,148 @@ BOOST_AUTO_TEST_CASE(hashmap__record_it__multiple__iterated)
     //    000000c3
 }
 
+// bucket stats
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__get_bucket_stats__empty__all_empty)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    const auto stats = instance.get_bucket_stats(3);
+    BOOST_REQUIRE_EQUAL(stats.buckets, buckets);
+    BOOST_REQUIRE_EQUAL(stats.empty, buckets);
+    BOOST_REQUIRE_EQUAL(stats.lengths.front(), buckets);
+    BOOST_REQUIRE_EQUAL(stats.rows, zero);
+    BOOST_REQUIRE_EQUAL(stats.longest, zero);
+    BOOST_REQUIRE_EQUAL(stats.probes, zero);
+    BOOST_REQUIRE_EQUAL(stats.hit_bytes, zero);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__get_bucket_stats__multiple__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    // Keys map to three distinct buckets (see hashmap__record_it__multiple).
+    for (const auto key: { key1{ 0xaa }, key1{ 0xbb }, key1{ 0xcc } })
+        for (auto value = 0_u32; value < 3u; ++value)
+            BOOST_REQUIRE(!instance.put_link(key, big_record{ value }).is_terminal());
+
+    // Ranges exceeding buckets are limited to buckets.
+    const auto stats = instance.get_bucket_stats(100);
+    BOOST_REQUIRE_EQUAL(stats.buckets, buckets);
+    BOOST_REQUIRE_EQUAL(stats.empty, buckets - 3u);
+    BOOST_REQUIRE_EQUAL(stats.lengths.at(0), buckets - 3u);
+    BOOST_REQUIRE_EQUAL(stats.lengths.at(3), 3u);
+    BOOST_REQUIRE_EQUAL(stats.rows, 9u);
+    BOOST_REQUIRE_EQUAL(stats.longest, 3u);
+
+    // Five byte cells have no filter bits, so no probe is screened.
+    BOOST_REQUIRE_EQUAL(stats.filter_bits, zero);
+    BOOST_REQUIRE_EQUAL(stats.probes, 3u * 8u);
+    BOOST_REQUIRE_EQUAL(stats.screened, zero);
+
+    // Each list: 3 cells (5) and 1 + 2 + 3 link/key prefixes (6).
+    BOOST_REQUIRE_EQUAL(stats.hit_bytes, 3u * (3u * 5u + 6u * 6u));
+
+    // Each bucket probe reads a cell, each occupied probe a full list.
+    BOOST_REQUIRE_EQUAL(stats.miss_bytes, buckets * 8u * 5u + 3u * 8u * 3u * 6u);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+// rehash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__non_empty_target__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    test::chunk_storage target_store{};
+    target_store.buffer().resize(42);
+    BOOST_REQUIRE(!instance.rehash(target_store, 2u * buckets));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__more_buckets__relinked)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (const auto key: { key1{ 0xaa }, key1{ 0xbb }, key1{ 0xcc } })
+        for (auto value = 1_u32; value <= 3u; ++value)
+            BOOST_REQUIRE(!instance.put_link(key, big_record{ value }).is_terminal());
+
+    constexpr auto rebuckets = 2u * buckets;
+    test::chunk_storage target_store{};
+    BOOST_REQUIRE(instance.rehash(target_store, rebuckets, 3));
+
+    const hashmap_<link5, key1, big_record::size> rehashed{ target_store, body_store, rebuckets };
+    BOOST_REQUIRE(rehashed.verify());
+    BOOST_REQUIRE_EQUAL(rehashed.buckets(), rebuckets);
+    BOOST_REQUIRE_EQUAL(rehashed.count(), 9u);
+
+    const auto stats = rehashed.get_bucket_stats();
+    BOOST_REQUIRE_EQUAL(stats.empty, rebuckets - 3u);
+    BOOST_REQUIRE_EQUAL(stats.rows, 9u);
+    BOOST_REQUIRE_EQUAL(stats.longest, 3u);
+
+    // Each key retains its newest first order.
+    big_record record{};
+    auto it = rehashed.it(key1{ 0xbb });
+    BOOST_REQUIRE(rehashed.get(it, record));
+    BOOST_REQUIRE_EQUAL(record.value, 3u);
+    BOOST_REQUIRE(it.advance());
+    BOOST_REQUIRE(rehashed.get(it, record));
+    BOOST_REQUIRE_EQUAL(record.value, 2u);
+    BOOST_REQUIRE(it.advance());
+    BOOST_REQUIRE(rehashed.get(it, record));
+    BOOST_REQUIRE_EQUAL(record.value, 1u);
+    BOOST_REQUIRE(!it.advance());
+    it.reset();
+    BOOST_REQUIRE(!rehashed.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__one_bucket__all_found)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (const auto key: { key1{ 0xaa }, key1{ 0xbb }, key1{ 0xcc } })
+        for (auto value = 1_u32; value <= 3u; ++value)
+            BOOST_REQUIRE(!instance.put_link(key, big_record{ value }).is_terminal());
+
+    // Lists of all source ranges are pushed concurrently to a common bucket.
+    test::chunk_storage target_store{};
+    BOOST_REQUIRE(instance.rehash(target_store, 1, buckets));
+
+    hashmap_<link5, key1, big_record::size> rehashed{ target_store, body_store, 1 };
+    BOOST_REQUIRE(rehashed.verify());
+    BOOST_REQUIRE_EQUAL(rehashed.get_bucket_stats().longest, 9u);
+
+    big_record record{};
+    for (const auto key: { key1{ 0xaa }, key1{ 0xbb }, key1{ 0xcc } })
+    {
+        BOOST_REQUIRE(rehashed.find(key, record));
+        BOOST_REQUIRE_EQUAL(record.value, 3u);
+        BOOST_REQUIRE_EQUAL(rehashed.get_key(rehashed.first(key)), key);
+    }
+
+    BOOST_REQUIRE(!rehashed.get_fault());
+}
+
 // mutiphase commit.
 // ----------------------------------------------------------------------------
 
@@ -227,6 +227,36 @@ BOOST_AUTO_TEST_CASE(hashmaps__spine_it__duplicate_key__iterated)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(hashmaps__spine_first_many__mixed__same_as_first)
+{
+    test::chunk_storage head_store{};
+    body_storages body_store{ body_paths };
+    table instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    // Keys span two prefetch groups, with conflicts (16 buckets).
+    std::vector<key1> keys{};
+    for (auto value = 0_u8; value < 40u; ++value)
+    {
+        keys.push_back(key1{ value });
+        if (is_odd(value))
+            BOOST_REQUIRE(instance.put(keys.back(), little_record{ value }));
+    }
+
+    std::vector<link5> links(keys.size());
+    instance.first_many(keys, links);
+    const auto exists = instance.exists_many(keys);
+    BOOST_REQUIRE_EQUAL(exists.size(), keys.size());
+
+    for (size_t index{}; index < keys.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(links.at(index), instance.first(keys.at(index)));
+        BOOST_REQUIRE_EQUAL(exists.at(index), is_odd(index));
+    }
+
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 // satellites
 // ----------------------------------------------------------------------------
 
@@ -273,6 +303,42 @@ BOOST_AUTO_TEST_CASE(hashmaps__satellite_put__spine_allocated__expected)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+// rehash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(hashmaps__rehash__more_buckets__relinked)
+{
+    test::chunk_storage head_store{};
+    body_storages body_store{ body_paths };
+    table instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    constexpr key1 key_twin{ 0x41 };
+    constexpr key1 key_other{ 0x42 };
+    BOOST_REQUIRE(instance.put(key_twin, little_record{ 0x04030201_u32 }));
+    BOOST_REQUIRE(instance.put(key_other, little_record{ 0x08070605_u32 }));
+    BOOST_REQUIRE(instance.put(key_twin, little_record{ 0x0c0b0a09_u32 }));
+
+    constexpr auto rebuckets = 2u * buckets;
+    test::chunk_storage target_store{};
+    BOOST_REQUIRE(instance.rehash(target_store, rebuckets));
+
+    // Satellite columns are unaffected, the spine is relinked in key order.
+    const table rehashed{ target_store, body_store, rebuckets };
+    BOOST_REQUIRE(rehashed.verify());
+    BOOST_REQUIRE_EQUAL(rehashed.count(), 3u);
+    BOOST_REQUIRE_EQUAL(rehashed.first(key_other), 1u);
+
+    auto it = rehashed.it(key_twin);
+    BOOST_REQUIRE(it);
+    BOOST_REQUIRE_EQUAL(*it, 2u);
+    BOOST_REQUIRE(it.advance());
+    BOOST_REQUIRE_EQUAL(*it, 0u);
+    BOOST_REQUIRE(!it.advance());
+    it.reset();
+    BOOST_REQUIRE(!rehashed.get_fault());
+}
+
 // close/restore
 // ----------------------------------------------------------------------------
 
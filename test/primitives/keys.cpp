@@ -101,4 +101,49 @@ BOOST_AUTO_TEST_CASE(keys__hash_thumb__similarity__expected)
     BOOST_REQUIRE_EQUAL(system::ones_count(xor2), 34u);
 }
 
+BOOST_AUTO_TEST_CASE(keys__restorable__keys__expected)
+{
+    static_assert(keys::restorable<chain::point>());
+    static_assert(keys::restorable<hash_digest>());
+    static_assert(keys::restorable<keys::search<hash_size>>());
+    static_assert(!keys::restorable<keys::search<8>>());
+    BOOST_REQUIRE(keys::restorable<data_array<3>>());
+}
+
+BOOST_AUTO_TEST_CASE(keys__read__point__expected)
+{
+    data_array<35> bytes{};
+    std::copy_n(hash1.begin(), hash_size, bytes.begin());
+    bytes.at(32) = 0x78;
+    bytes.at(33) = 0x56;
+    bytes.at(34) = 0x34;
+
+    const auto point = keys::read<chain::point>(bytes);
+    BOOST_REQUIRE_EQUAL(point.hash(), hash1);
+    BOOST_REQUIRE_EQUAL(point.index(), 0x00345678_u32);
+    BOOST_REQUIRE(keys::compare(bytes, point));
+}
+
+BOOST_AUTO_TEST_CASE(keys__read__null_point__null_index)
+{
+    data_array<35> bytes{};
+    std::copy_n(hash2.begin(), hash_size, bytes.begin());
+    bytes.at(32) = 0xff;
+    bytes.at(33) = 0xff;
+    bytes.at(34) = 0xff;
+
+    // The truncated null index restores to the full null index (bucket zero).
+    const auto point = keys::read<chain::point>(bytes);
+    BOOST_REQUIRE_EQUAL(point.hash(), hash2);
+    BOOST_REQUIRE_EQUAL(point.index(), chain::point::null_index);
+    BOOST_REQUIRE_EQUAL(keys::bucket(point, 16_size), zero);
+}
+
+BOOST_AUTO_TEST_CASE(keys__read__search__expected)
+{
+    const auto key = keys::read<keys::search<hash_size>>(hash0);
+    BOOST_REQUIRE_EQUAL(key.value, hash0);
+    BOOST_REQUIRE_EQUAL(keys::hash(key), keys::hash(hash0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+#include "../../mocks/chunk_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(query_address_tests, test::directory_setup_fixture)
+
+// get_address_summary
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__disabled__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+    BOOST_REQUIRE(!query.summary_enabled());
+
+    address_summary out{ 1, 2, 3, 4, 5 };
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0u);
+    BOOST_REQUIRE_EQUAL(out.funded, 0u);
+    BOOST_REQUIRE_EQUAL(out.spent, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__genesis__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.summary_enabled());
+
+    address_summary out{};
+    BOOST_REQUIRE(query.get_address_summary(out, test::genesis_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 5'000'000'000u);
+    BOOST_REQUIRE_EQUAL(out.funded, 1u);
+    BOOST_REQUIRE_EQUAL(out.spent, 0u);
+    BOOST_REQUIRE_EQUAL(out.first, 0u);
+    BOOST_REQUIRE_EQUAL(out.last, 0u);
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__confirmed_blocks__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+
+    // block1a_address0 has 4 confirmed outputs (blocks 1a/2a/2a/3a).
+    // block1a (value: 0x18) is confirmed spent by block2a0.
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    address_summary out{};
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 389u);
+    BOOST_REQUIRE_EQUAL(out.funded, 4u);
+    BOOST_REQUIRE_EQUAL(out.spent, 1u);
+    BOOST_REQUIRE_EQUAL(out.first, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 3u);
+
+    // Summary is the confirmed balance source when enabled.
+    uint64_t confirmed{};
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.get_confirmed_balance(cancel, confirmed, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(confirmed, 389u);
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__pop_confirmed__reverted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    // block3a (value: 0x83) is unconfirmed, last is of prior activity (2a).
+    BOOST_REQUIRE(query.pop_confirmed());
+
+    address_summary out{};
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 258u);
+    BOOST_REQUIRE_EQUAL(out.funded, 3u);
+    BOOST_REQUIRE_EQUAL(out.spent, 1u);
+    BOOST_REQUIRE_EQUAL(out.first, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 2u);
+
+    // Reconfirmation restores the prior summary.
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block3a.hash()), true));
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 389u);
+    BOOST_REQUIRE_EQUAL(out.funded, 4u);
+    BOOST_REQUIRE_EQUAL(out.spent, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__pop_after_gap__prior_last)
+{
+    using namespace system;
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+
+    // One tx block paying 0x42 to the script, spending a missing prevout.
+    const auto make = [](const hash_digest& parent, uint32_t version,
+        const chain::script& script) NOEXCEPT
+    {
+        return chain::block
+        {
+            chain::header
+            {
+                0x31323334,
+                parent,
+                hash_digest{ 0x4a },
+                0x41424344,
+                0x51525354,
+                0x61626364
+            },
+            chain::transactions
+            {
+                chain::transaction
+                {
+                    version,
+                    chain::inputs
+                    {
+                        chain::input
+                        {
+                            chain::point{ one_hash, version },
+                            chain::script{},
+                            chain::witness{},
+                            0x00
+                        }
+                    },
+                    chain::outputs
+                    {
+                        chain::output
+                        {
+                            0x42,
+                            script
+                        }
+                    },
+                    0x00
+                }
+            }
+        };
+    };
+
+    // block1a_address0 (pick) is funded at heights 1 and 3, but not 2.
+    const auto block2 = make(test::block1a.hash(), 0x4b, chain::script{ { { chain::opcode::size } } });
+    const auto block3 = make(block2.hash(), 0x4c, chain::script{ { { chain::opcode::pick } } });
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(block3, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1a.hash()), true));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(block2.hash()), true));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(block3.hash()), true));
+
+    address_summary out{};
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.funded, 2u);
+    BOOST_REQUIRE_EQUAL(out.first, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 3u);
+
+    // Last is that of the prior activity, not the height below the popped.
+    BOOST_REQUIRE(query.pop_confirmed());
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0x18u);
+    BOOST_REQUIRE_EQUAL(out.funded, 1u);
+    BOOST_REQUIRE_EQUAL(out.first, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 1u);
+
+    // Batched pop recomputes over the history that remains confirmed.
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(block3.hash()), true));
+    BOOST_REQUIRE(query.pop_confirmed_to(1));
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.funded, 1u);
+    BOOST_REQUIRE_EQUAL(out.last, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__address_disabled__disabled)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.outs.buckets = 0;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.address_enabled());
+    BOOST_REQUIRE(!query.summary_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_address_summary__pop_all__emptied)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+    BOOST_REQUIRE(query.pop_confirmed());
+    BOOST_REQUIRE(query.pop_confirmed());
+    BOOST_REQUIRE(query.pop_confirmed());
+
+    // The row remains, with no confirmed activity.
+    address_summary out{ 1, 2, 3, 4, 5 };
+    BOOST_REQUIRE(query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0u);
+    BOOST_REQUIRE_EQUAL(out.funded, 0u);
+    BOOST_REQUIRE_EQUAL(out.spent, 0u);
+    BOOST_REQUIRE_EQUAL(out.first, 0u);
+    BOOST_REQUIRE_EQUAL(out.last, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -427,6 +427,93 @@ BOOST_AUTO_TEST_CASE(query_chain_reader__get_tx_position__strong__expected)
     BOOST_CHECK_EQUAL(query.get_position_tx(3, 0), 4u);
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_tx_position__layout__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.layout.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_CHECK(query.set(test::block2a, context{ 0, 2, 0 }, false, false));
+    BOOST_CHECK(query.set(test::block3a, context{ 0, 3, 0 }, false, false));
+    BOOST_CHECK(query.set_strong(1));
+    BOOST_CHECK(query.set_strong(2));
+    BOOST_CHECK(query.set_strong(3));
+
+    size_t out{};
+    BOOST_CHECK(query.get_tx_position(out, 2));
+    BOOST_CHECK_EQUAL(out, 0u);
+    BOOST_CHECK(query.get_tx_position(out, 3));
+    BOOST_CHECK_EQUAL(out, 1u);
+    BOOST_CHECK(query.get_tx_position(out, 4));
+    BOOST_CHECK_EQUAL(out, 0u);
+    BOOST_CHECK(!query.get_tx_position(out, 3, 3));
+    BOOST_CHECK(!query.get_tx_position(out, 5));
+
+    BOOST_CHECK_EQUAL(query.get_position_tx(1, 0), 1u);
+    BOOST_CHECK_EQUAL(query.get_position_tx(2, 0), 2u);
+    BOOST_CHECK_EQUAL(query.get_position_tx(2, 1), 3u);
+    BOOST_CHECK_EQUAL(query.get_position_tx(3, 0), 4u);
+    BOOST_CHECK(query.get_position_tx(2, 2).is_terminal());
+
+    const auto& txs = *test::block2a.transactions_ptr();
+    const auto keys = query.get_tx_keys(2);
+    BOOST_CHECK_EQUAL(keys.size(), txs.size());
+    BOOST_CHECK_EQUAL(keys.front(), txs.front()->hash(false));
+    BOOST_CHECK_EQUAL(keys.back(), txs.back()->hash(false));
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_tx_offset__layout__expected)
+{
+    using namespace system;
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.layout.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_CHECK(query.set(test::block2a, context{ 0, 2, 0 }, false, false));
+
+    const auto& tx = *test::block2a.transactions_ptr()->back();
+    const auto wire = test::block2a.to_data(true);
+    size_t offset{};
+    size_t size{};
+    BOOST_CHECK(query.get_tx_offset(offset, size, 2, 1, true));
+    BOOST_CHECK_EQUAL(size, tx.serialized_size(true));
+    BOOST_CHECK_EQUAL(offset + size, wire.size());
+    BOOST_CHECK_EQUAL(data_chunk(std::next(wire.begin(), offset), wire.end()),
+        tx.to_data(true));
+
+    size_t position{};
+    BOOST_CHECK(query.get_offset_position(position, 2, offset, true));
+    BOOST_CHECK_EQUAL(position, 1u);
+    BOOST_CHECK(query.get_offset_position(position, 2, sub1(offset), true));
+    BOOST_CHECK_EQUAL(position, 0u);
+    BOOST_CHECK(!query.get_offset_position(position, 2, wire.size(), true));
+    BOOST_CHECK(!query.get_tx_offset(offset, size, 2, 2, true));
+    BOOST_CHECK(!query.get_tx_offset(offset, size, 3, 0, true));
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_tx_offset__disabled__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    size_t offset{};
+    size_t size{};
+    BOOST_CHECK(!query.get_tx_offset(offset, size, 0, 0, false));
+    BOOST_CHECK(!query.get_offset_position(offset, 0, 81, false));
+}
+
 BOOST_AUTO_TEST_CASE(query_chain_reader__get_tx_position__always__expected)
 {
     settings settings{};
@@ -690,6 +777,79 @@ BOOST_AUTO_TEST_CASE(query_chain_reader__get_transactions__found__expected)
     BOOST_CHECK_EQUAL(query.get_transactions(2, false)->size(), 2u);
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_stored_block__not_found__invalid)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    BOOST_CHECK(!query.get_stored_block(1));
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_stored_block__found__matches_block)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::block2a, test::context, false, false));
+
+    const auto block = query.get_block(2, true);
+    BOOST_REQUIRE(block);
+
+    const auto pointer = query.get_stored_block(2);
+    BOOST_REQUIRE(pointer);
+
+    const auto& view = *pointer;
+    BOOST_REQUIRE(view);
+    BOOST_REQUIRE_EQUAL(view.transactions(), block->transactions());
+    BOOST_CHECK(!view.transaction(view.transactions()));
+
+    for (size_t position{}; position < view.transactions(); ++position)
+    {
+        const auto& tx = *block->transactions_ptr()->at(position);
+        const auto stored = view.transaction(position);
+        BOOST_REQUIRE(stored);
+        BOOST_CHECK_EQUAL(stored.hash(), tx.hash(false));
+        BOOST_CHECK_EQUAL(stored.version(), tx.version());
+        BOOST_CHECK_EQUAL(stored.locktime(), tx.locktime());
+        BOOST_CHECK_EQUAL(stored.is_coinbase(), tx.is_coinbase());
+        BOOST_CHECK_EQUAL(stored.light(), tx.serialized_size(false));
+        BOOST_CHECK_EQUAL(stored.heavy(), tx.serialized_size(true));
+        BOOST_REQUIRE_EQUAL(stored.inputs(), tx.inputs_ptr()->size());
+        BOOST_REQUIRE_EQUAL(stored.outputs(), tx.outputs_ptr()->size());
+
+        stored_input in{};
+        BOOST_CHECK(!stored.get_input(in, stored.inputs()));
+        for (size_t index{}; index < stored.inputs(); ++index)
+        {
+            const auto& input = *tx.inputs_ptr()->at(index);
+            BOOST_REQUIRE(stored.get_input(in, index));
+            BOOST_CHECK_EQUAL(in.hash, input.point().hash());
+            BOOST_CHECK_EQUAL(in.index, input.point().index());
+            BOOST_CHECK_EQUAL(in.sequence, input.sequence());
+            BOOST_CHECK(in.script.to_chunk() == input.script().to_data(false));
+            BOOST_CHECK(in.witness.to_chunk() == input.witness().to_data(true));
+        }
+
+        stored_output out{};
+        BOOST_CHECK(!stored.get_output(out, stored.outputs()));
+        for (size_t index{}; index < stored.outputs(); ++index)
+        {
+            const auto& output = *tx.outputs_ptr()->at(index);
+            BOOST_REQUIRE(stored.get_output(out, index));
+            BOOST_CHECK_EQUAL(out.value, output.value());
+            BOOST_CHECK(out.script.to_chunk() == output.script().to_data(false));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(query_chain_reader__get_spenders__unspent_or_not_found__expected)
 {
     settings settings{};
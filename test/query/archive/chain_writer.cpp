@@ -766,6 +766,225 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__set_block_txs__get_block__expected)
     BOOST_CHECK_EQUAL(hashes, test::genesis.transaction_hashes(false));
 }
 
+// The block-batched chain writer must produce a store byte-identical to the
+// view (wire) block writer, for blocks with multiple txs, inputs and outputs.
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_block__batched__matches_block_view)
+{
+    settings settings{};
+    settings.header.buckets = 8;
+    settings.tx.buckets = 8;
+    settings.ins.buckets = 8;
+    settings.txs.buckets = 16;
+    settings.path = TEST_DIRECTORY;
+    const auto blocks = { test::block1a, test::block2a, test::block3a };
+
+    // Chain (block-batched) writer.
+    test::chunk_store expected{ settings };
+    test::query_accessor chain_query{ expected };
+    BOOST_CHECK(!expected.create(test::events_handler));
+    BOOST_CHECK(chain_query.initialize(test::genesis));
+
+    for (const auto& block: blocks)
+        BOOST_CHECK(chain_query.set(block, test::context, false, false));
+
+    const auto pointer = chain_query.get_block(chain_query.to_header(test::block2a.hash()), true);
+    BOOST_CHECK(pointer);
+    BOOST_CHECK(*pointer == test::block2a);
+    BOOST_CHECK(!expected.close(test::events_handler));
+
+    // View (wire) writer.
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    for (const auto& block: blocks)
+    {
+        BOOST_CHECK(query.set(block.header(), test::context, false));
+        const system::chain::block_view view{ block.to_data(true), true };
+        BOOST_CHECK(view.is_valid());
+        BOOST_CHECK_EQUAL(query.set_code(view, false, false), error::success);
+    }
+
+    BOOST_CHECK(!store.close(test::events_handler));
+    BOOST_CHECK_EQUAL(store.tx_body(), expected.tx_body());
+    BOOST_CHECK_EQUAL(store.ins_body(), expected.ins_body());
+    BOOST_CHECK_EQUAL(store.ins_sequence_body(), expected.ins_sequence_body());
+    BOOST_CHECK_EQUAL(store.input_body(), expected.input_body());
+    BOOST_CHECK_EQUAL(store.output_body(), expected.output_body());
+    BOOST_CHECK_EQUAL(store.outs_body(), expected.outs_body());
+    BOOST_CHECK_EQUAL(store.txs_body(), expected.txs_body());
+    BOOST_CHECK_EQUAL(store.duplicate_body(), expected.duplicate_body());
+}
+
+// Block of 70 txs (above the concurrent write threshold), where the last tx
+// spends the first point of the second tx (an in-block duplicate point).
+static system::chain::block large_block_() NOEXCEPT
+{
+    using namespace system::chain;
+    constexpr uint32_t count = 70;
+    transactions txs{};
+    txs.reserve(count);
+    for (uint32_t index{}; index < count; ++index)
+    {
+        inputs ins
+        {
+            input
+            {
+                point{ system::one_hash, index },
+                script{ { { opcode::op_return }, { opcode::pick } } },
+                witness{ "[242424]" },
+                index
+            }
+        };
+
+        if (index == sub1(count))
+            ins.emplace_back(point{ system::one_hash, 1 },
+                script{ { { opcode::op_return }, { opcode::roll } } },
+                witness{ "[313131]" }, index);
+
+        txs.emplace_back(0x2a, std::move(ins), outputs
+        {
+            output{ index, script{ { { opcode::pick } } } }
+        }, index);
+    }
+
+    const block instance
+    {
+        header
+        {
+            0x31323334,
+            test::block0_hash,
+            system::hash_digest{ 0x1a },
+            0x41424344,
+            0x51525354,
+            0x61626364
+        },
+        std::move(txs)
+    };
+
+    // Deserialize for the cached tx hashes of a network block.
+    return block{ instance.to_data(true), true };
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_block__concurrent__matches_sequential)
+{
+    settings settings{};
+    settings.header.buckets = 8;
+    settings.tx.buckets = 8;
+    settings.ins.buckets = 8;
+    settings.txs.buckets = 16;
+    settings.duplicate.buckets = 8;
+    settings.path = TEST_DIRECTORY;
+    const auto block = large_block_();
+    const auto& txs = *block.transactions_ptr();
+    const auto twin = system::chain::point{ system::one_hash, 1 };
+
+    // Sequential (one tx at a time) writer.
+    test::chunk_store expected{ settings };
+    test::query_accessor sequential{ expected };
+    BOOST_CHECK(!expected.create(test::events_handler));
+    BOOST_CHECK(sequential.initialize(test::genesis));
+    BOOST_CHECK(sequential.set(block.header(), test::context, false));
+
+    for (const auto& tx: txs)
+        BOOST_CHECK(sequential.set(*tx));
+
+    // Block (concurrent) writer, collecting in-block duplicates.
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(block, test::context, false, false));
+
+    // Same tx links and points, in block order.
+    for (const auto& tx: txs)
+    {
+        const auto link = query.to_tx(tx->hash(false));
+        BOOST_CHECK(!link.is_terminal());
+        BOOST_CHECK_EQUAL(link, sequential.to_tx(tx->hash(false)));
+
+        const auto points = query.to_points(link);
+        BOOST_CHECK_EQUAL(points.size(), tx->inputs_ptr()->size());
+        BOOST_CHECK(points == sequential.to_points(link));
+
+        for (const auto& point: points)
+            BOOST_CHECK(query.get_point_key(point) ==
+                sequential.get_point_key(point));
+    }
+
+    // The twin is recorded once and both spenders are indexed.
+    BOOST_CHECK_EQUAL(query.duplicate_records(), one);
+    BOOST_CHECK_EQUAL(sequential.duplicate_records(), one);
+    BOOST_CHECK_EQUAL(query.get_spenders(twin).size(), two);
+    BOOST_CHECK_EQUAL(sequential.get_spenders(twin).size(), two);
+
+    // Unkeyed (slab and sequence) rows are identical.
+    BOOST_CHECK(!store.close(test::events_handler));
+    BOOST_CHECK(!expected.close(test::events_handler));
+    BOOST_CHECK_EQUAL(store.input_body(), expected.input_body());
+    BOOST_CHECK_EQUAL(store.output_body(), expected.output_body());
+    BOOST_CHECK_EQUAL(store.ins_sequence_body(), expected.ins_sequence_body());
+    BOOST_CHECK_EQUAL(store.outs_body(), expected.outs_body());
+    BOOST_CHECK_EQUAL(store.duplicate_body(), expected.duplicate_body());
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_block_view__concurrent__matches_sequential)
+{
+    settings settings{};
+    settings.header.buckets = 8;
+    settings.tx.buckets = 8;
+    settings.ins.buckets = 8;
+    settings.txs.buckets = 16;
+    settings.duplicate.buckets = 8;
+    settings.path = TEST_DIRECTORY;
+    const auto block = large_block_();
+    const auto& txs = *block.transactions_ptr();
+    const auto twin = system::chain::point{ system::one_hash, 1 };
+
+    // Sequential (one tx at a time) writer.
+    test::chunk_store expected{ settings };
+    test::query_accessor sequential{ expected };
+    BOOST_CHECK(!expected.create(test::events_handler));
+    BOOST_CHECK(sequential.initialize(test::genesis));
+    BOOST_CHECK(sequential.set(block.header(), test::context, false));
+
+    for (const auto& tx: txs)
+        BOOST_CHECK(sequential.set(*tx));
+
+    // View (wire, concurrent) writer, collecting in-block duplicates.
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(block.header(), test::context, false));
+    const system::chain::block_view view{ block.to_data(true), true };
+    BOOST_CHECK(view.is_valid());
+    BOOST_CHECK_EQUAL(query.set_code(view, false, false), error::success);
+
+    // Same tx links and points, in block order.
+    for (const auto& tx: txs)
+    {
+        const auto link = query.to_tx(tx->hash(false));
+        BOOST_CHECK(!link.is_terminal());
+        BOOST_CHECK_EQUAL(link, sequential.to_tx(tx->hash(false)));
+        BOOST_CHECK(query.to_points(link) == sequential.to_points(link));
+    }
+
+    // The twin is recorded once and both spenders are indexed.
+    BOOST_CHECK_EQUAL(query.duplicate_records(), one);
+    BOOST_CHECK_EQUAL(query.get_spenders(twin).size(), two);
+
+    // Unkeyed (slab and sequence) rows are identical.
+    BOOST_CHECK(!store.close(test::events_handler));
+    BOOST_CHECK(!expected.close(test::events_handler));
+    BOOST_CHECK_EQUAL(store.input_body(), expected.input_body());
+    BOOST_CHECK_EQUAL(store.output_body(), expected.output_body());
+    BOOST_CHECK_EQUAL(store.ins_sequence_body(), expected.ins_sequence_body());
+    BOOST_CHECK_EQUAL(store.outs_body(), expected.outs_body());
+    BOOST_CHECK_EQUAL(store.duplicate_body(), expected.duplicate_body());
+}
+
 // populate_with_metadata
 // ----------------------------------------------------------------------------
 
@@ -890,6 +1109,46 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__populate_with_metadata__metadata__expec
     BOOST_CHECK_EQUAL(tx4.inputs_ptr()->at(1)->metadata.parent_tx, 1u);
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__populate_with_metadata__block__same_as_inputs)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::block2a, test::context, false, false));
+
+    // Block population resolves all prevouts in batch (some are missing).
+    const auto& block2a = clean_(test::block2a);
+    BOOST_CHECK(!query.populate_with_metadata(block2a));
+
+    std::vector<bool> prevouts{};
+    std::vector<uint32_t> parents{};
+    for (const auto& input: *block2a.inputs_ptr())
+    {
+        prevouts.push_back(!is_null(input->prevout));
+        parents.push_back(input->metadata.parent_tx);
+    }
+
+    // Each (non-coinbase) input populates as it would individually.
+    clean_(block2a);
+    const auto& txs = *block2a.transactions_ptr();
+    size_t index{ txs.front()->inputs_ptr()->size() };
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+    {
+        for (const auto& input: *(*tx)->inputs_ptr())
+        {
+            BOOST_CHECK_EQUAL(query.populate_with_metadata(*input), prevouts.at(index));
+            BOOST_CHECK_EQUAL(input->metadata.parent_tx, parents.at(index));
+            ++index;
+        }
+    }
+
+    BOOST_CHECK_EQUAL(index, prevouts.size());
+}
+
 // populate_without_metadata
 // ----------------------------------------------------------------------------
 
@@ -941,6 +1200,44 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__populate_without_metadata__partial_prev
     BOOST_CHECK(query.populate_without_metadata(*test::tx4.inputs_ptr()->at(1)));
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__populate_without_metadata__block__same_as_inputs)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::block2a, test::context, false, false));
+
+    // Block population resolves all prevouts in batch (some are missing).
+    const auto& block2a = clean_(test::block2a);
+    BOOST_CHECK(!query.populate_without_metadata(block2a));
+
+    std::vector<system::chain::output::cptr> prevouts{};
+    for (const auto& input: *block2a.inputs_ptr())
+        prevouts.push_back(input->prevout);
+
+    // Each (non-coinbase) input populates as it would individually.
+    clean_(block2a);
+    const auto& txs = *block2a.transactions_ptr();
+    size_t index{ txs.front()->inputs_ptr()->size() };
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+    {
+        for (const auto& input: *(*tx)->inputs_ptr())
+        {
+            const auto& expected = prevouts.at(index++);
+            BOOST_CHECK_EQUAL(query.populate_without_metadata(*input), !is_null(expected));
+            BOOST_CHECK_EQUAL(is_null(input->prevout), is_null(expected));
+            if (!is_null(expected) && !is_null(input->prevout))
+                BOOST_CHECK(*input->prevout == *expected);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(index, prevouts.size());
+}
+
 // ----------------------------------------------------------------------------
 
 // archive_write (foreign-keyed)
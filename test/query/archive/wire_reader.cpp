@@ -132,4 +132,160 @@ BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__witness_false__expected)
     BOOST_CHECK(!store.close(test::events_handler));
 }
 
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__multiple_txs__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, true), test::block2a.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, false), test::block2a.to_data(false));
+    BOOST_CHECK(query.get_wire_block(4, true).empty());
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+// get_block_stream
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_block_stream__not_found__nullptr)
+{
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK(!query.get_block_stream(4, true));
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_block_stream__read_chunks__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    const auto expected = test::block2a.to_data(true);
+    data_chunk streamed{};
+    {
+        const auto stream = query.get_block_stream(2, true);
+        BOOST_REQUIRE(stream);
+
+        data_chunk chunk(7);
+        size_t count{};
+        while ((count = stream->read(chunk)))
+            streamed.insert(streamed.end(), chunk.begin(),
+                std::next(chunk.begin(), count));
+
+        BOOST_CHECK(stream->done());
+        BOOST_CHECK(!stream->fault());
+    }
+
+    BOOST_CHECK_EQUAL(streamed, expected);
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_block_stream__gather__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    const auto expected = test::block2a.to_data(false);
+    data_chunk streamed{};
+    {
+        const auto stream = query.get_block_stream(2, false);
+        BOOST_REQUIRE(stream);
+
+        block_stream::slices slices{};
+        while (!is_zero(stream->gather(slices, 50)))
+        {
+            for (const auto& slice: slices)
+                streamed.insert(streamed.end(), slice.begin(), slice.end());
+        }
+
+        BOOST_CHECK(stream->done());
+        BOOST_CHECK(!stream->fault());
+    }
+
+    BOOST_CHECK_EQUAL(streamed, expected);
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_block_stream__read_interleaved_writes__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    const auto expected = test::block2a.to_data(true);
+    const auto stream = query.get_block_stream(2, true);
+    BOOST_REQUIRE(stream);
+
+    // Archive tables are written between reads (stream holds no memory).
+    data_chunk streamed(expected.size());
+    const auto begin = streamed.data();
+    const auto half = std::next(begin, to_half(streamed.size()));
+    const auto end = std::next(begin, streamed.size());
+    BOOST_CHECK_EQUAL(stream->read({ begin, half }), to_half(streamed.size()));
+    BOOST_CHECK(query.set(test::block3a, database::context{ 0, 3, 0 }, false, false));
+    BOOST_CHECK_EQUAL(stream->read({ half, end }), streamed.size() - to_half(streamed.size()));
+    BOOST_CHECK(stream->done());
+    BOOST_CHECK(!stream->fault());
+    BOOST_CHECK_EQUAL(streamed, expected);
+    BOOST_CHECK_EQUAL(query.get_wire_block(3, true), test::block3a.to_data(true));
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_block_stream__gather_interleaved_writes__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    const auto expected = test::block2a.to_data(true);
+    const auto stream = query.get_block_stream(2, true);
+    BOOST_REQUIRE(stream);
+
+    // Slices are consumed before release, and archive tables are then written.
+    auto written = false;
+    data_chunk streamed{};
+    block_stream::slices slices{};
+    while (!is_zero(stream->gather(slices, 11)))
+    {
+        for (const auto& slice: slices)
+            streamed.insert(streamed.end(), slice.begin(), slice.end());
+
+        stream->release();
+        if (!written)
+        {
+            written = true;
+            BOOST_CHECK(query.set(test::block3a, database::context{ 0, 3, 0 }, false, false));
+        }
+    }
+
+    BOOST_CHECK(stream->done());
+    BOOST_CHECK(!stream->fault());
+    BOOST_CHECK_EQUAL(streamed, expected);
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -118,6 +118,101 @@ BOOST_AUTO_TEST_CASE(query_confirmed__is_confirmed_block__push_pop_confirmed__ex
     BOOST_REQUIRE(!query.is_confirmed_block(2));
 }
 
+BOOST_AUTO_TEST_CASE(query_confirmed__push_confirmed_range__pop_confirmed_to__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2a, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3a, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), one);
+
+    // Empty range and pop to top are no-ops.
+    BOOST_REQUIRE(query.push_confirmed_range({}, true));
+    BOOST_REQUIRE(query.pop_confirmed_to(0));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), zero);
+
+    BOOST_REQUIRE(query.push_confirmed_range({ 1, 2, 3 }, true));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), 3u);
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), 5u);
+    BOOST_REQUIRE_EQUAL(query.to_confirmed(1), 1u);
+    BOOST_REQUIRE_EQUAL(query.to_confirmed(2), 2u);
+    BOOST_REQUIRE_EQUAL(query.to_confirmed(3), 3u);
+    BOOST_REQUIRE(query.is_confirmed_tx(1));
+    BOOST_REQUIRE(query.is_confirmed_tx(2));
+    BOOST_REQUIRE(query.is_confirmed_tx(3));
+    BOOST_REQUIRE(query.is_confirmed_tx(4));
+    BOOST_REQUIRE_EQUAL(query.find_strong(3), 2u);
+
+    BOOST_REQUIRE(query.pop_confirmed_to(1));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), one);
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), 8u);
+    BOOST_REQUIRE(query.is_confirmed_block(1));
+    BOOST_REQUIRE(!query.is_confirmed_block(2));
+    BOOST_REQUIRE(!query.is_confirmed_block(3));
+    BOOST_REQUIRE(query.is_confirmed_tx(1));
+    BOOST_REQUIRE(!query.is_confirmed_tx(2));
+    BOOST_REQUIRE(!query.is_confirmed_tx(3));
+    BOOST_REQUIRE(!query.is_confirmed_tx(4));
+
+    // Range matches individual confirmation.
+    BOOST_REQUIRE(query.push_confirmed(2, true));
+    BOOST_REQUIRE(query.push_confirmed(3, true));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), 3u);
+    BOOST_REQUIRE(query.is_confirmed_tx(3));
+    BOOST_REQUIRE(query.is_confirmed_tx(4));
+}
+
+BOOST_AUTO_TEST_CASE(query_confirmed__push_confirmed_range__dense__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.dense_strong = true;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2a, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3a, context{ 0, 3, 0 }, false, false));
+
+    BOOST_REQUIRE(query.push_confirmed_range({ 1, 2, 3 }, true));
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), zero);
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), 5u);
+    BOOST_REQUIRE(query.is_confirmed_tx(4));
+    BOOST_REQUIRE_EQUAL(query.find_strong(3), 2u);
+
+    BOOST_REQUIRE(query.pop_confirmed_to(0));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), zero);
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), 5u);
+    BOOST_REQUIRE(query.is_confirmed_tx(0));
+    BOOST_REQUIRE(!query.is_confirmed_tx(1));
+    BOOST_REQUIRE(!query.is_confirmed_tx(4));
+    BOOST_REQUIRE(query.find_strong(3).is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(query_confirmed__push_confirmed_range__unassociated__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2a.header(), context{ 0, 2, 0 }, false));
+
+    // Nothing is written when any block is unassociated.
+    BOOST_REQUIRE(!query.push_confirmed_range({ 1, 2 }, true));
+    BOOST_REQUIRE(!query.push_confirmed_range({ 1, database::header_link::terminal }, false));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), zero);
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), one);
+}
+
 BOOST_AUTO_TEST_CASE(query_confirmed__is_confirmed_tx__confirm__expected)
 {
     settings settings{};
@@ -484,6 +579,51 @@ BOOST_AUTO_TEST_CASE(query_confirmed__set_strong__set_unstrong__expected)
     BOOST_REQUIRE(!query.is_confirmed_output(query.to_output(2, 0)));
 }
 
+BOOST_AUTO_TEST_CASE(query_confirmed__set_strong__dense_set_unstrong__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.dense_strong = true;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(1, false));
+    BOOST_REQUIRE(query.push_confirmed(2, false));
+    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), zero);
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), one);
+
+    BOOST_REQUIRE(query.is_confirmed_tx(0));
+    BOOST_REQUIRE(!query.is_confirmed_tx(1));
+    BOOST_REQUIRE(!query.is_confirmed_tx(2));
+
+    BOOST_REQUIRE(query.set_strong(1));
+    BOOST_REQUIRE(query.set_strong(2));
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), 3u);
+    BOOST_REQUIRE_EQUAL(query.find_strong(2), 2u);
+
+    BOOST_REQUIRE(query.is_confirmed_tx(1));
+    BOOST_REQUIRE(query.is_confirmed_input(query.to_point(1, 0)));
+    BOOST_REQUIRE(query.is_confirmed_output(query.to_output(1, 0)));
+    BOOST_REQUIRE(query.is_confirmed_tx(2));
+
+    // Unstrong and restrong overwrite in place (no growth).
+    BOOST_REQUIRE(query.set_unstrong(1));
+    BOOST_REQUIRE(query.set_unstrong(2));
+    BOOST_REQUIRE(query.set_strong(1));
+    BOOST_REQUIRE(query.set_unstrong(1));
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), 3u);
+
+    BOOST_REQUIRE(query.is_confirmed_tx(0));
+    BOOST_REQUIRE(!query.is_confirmed_tx(1));
+    BOOST_REQUIRE(!query.is_confirmed_input(query.to_point(1, 0)));
+    BOOST_REQUIRE(!query.is_confirmed_output(query.to_output(1, 0)));
+    BOOST_REQUIRE(!query.is_confirmed_tx(2));
+    BOOST_REQUIRE(query.find_strong(2).is_terminal());
+}
+
 constexpr auto bip68 = system::chain::flags::bip68_rule;
 
 BOOST_AUTO_TEST_CASE(query_confirmed__block_confirmable__bad_link__integrity_block_confirmable1)
@@ -19,7 +19,79 @@
 #include "../../test.hpp"
 #include "../../mocks/blocks.hpp"
 #include "../../mocks/chunk_store.hpp"
+#include "../../mocks/map_store.hpp"
 
 BOOST_FIXTURE_TEST_SUITE(query_consensus_tests, test::directory_setup_fixture)
 
+const auto& clean_(const auto& block_or_tx) NOEXCEPT
+{
+    const auto inputs = block_or_tx.inputs_ptr();
+    for (const auto& input: *inputs)
+    {
+        input->prevout.reset();
+        input->metadata = system::chain::prevout{};
+    }
+
+    return block_or_tx;
+}
+
+// prefetch_prevouts
+
+// Mock storage does not support advice, so no output is advised.
+BOOST_AUTO_TEST_CASE(query_consensus__prefetch_prevouts__unadvised_storage__zero_unpopulated)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::block2a, test::context, false, false));
+
+    const auto& block2a = clean_(test::block2a);
+    BOOST_CHECK_EQUAL(query.prefetch_prevouts(block2a), zero);
+    BOOST_CHECK_EQUAL(query.prefetch_prevouts(test::genesis), zero);
+
+    for (const auto& input: *block2a.inputs_ptr())
+        BOOST_CHECK(!input->prevout);
+}
+
+// Each stored prevout of the block is advised (missing prevouts are not).
+BOOST_AUTO_TEST_CASE(query_consensus__prefetch_prevouts__mmap__stored_prevouts)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ settings };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_CHECK(!instance.create(test::events_handler));
+    BOOST_CHECK(query_.initialize(test::genesis));
+    BOOST_CHECK(query_.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query_.set(test::block2a, test::context, false, false));
+    BOOST_CHECK(query_.set(test::block3a, test::context, false, false));
+
+    // block2a spends two stored and two missing prevouts, block3a two stored.
+    for (const auto block: { &test::block2a, &test::block3a })
+    {
+        const auto& copy = clean_(*block);
+        /* bool */ query_.populate_without_metadata(copy);
+
+        size_t stored{};
+        for (const auto& input: *copy.inputs_ptr())
+            if (input->prevout) ++stored;
+
+        BOOST_CHECK_EQUAL(stored, 2u);
+        clean_(copy);
+
+#if !defined(HAVE_MSC) && !defined(WITHOUT_MADVISE)
+        BOOST_CHECK_EQUAL(query_.prefetch_prevouts(copy), stored);
+#else
+        BOOST_CHECK_EQUAL(query_.prefetch_prevouts(copy), zero);
+#endif
+    }
+
+    BOOST_CHECK_EQUAL(query_.prefetch_prevouts(test::genesis), zero);
+    BOOST_CHECK(!instance.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -50,6 +50,7 @@ BOOST_AUTO_TEST_CASE(query_extent__body_sizes__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.candidate_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.confirmed_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.strong_tx_body_size(), schema::strong_tx::minrow);
+    BOOST_REQUIRE_EQUAL(query.strong_array_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.ecdsa_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.schnorr_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.silent_body_size(), zero);
@@ -60,6 +61,8 @@ BOOST_AUTO_TEST_CASE(query_extent__body_sizes__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.validated_tx_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.filter_bk_body_size(), schema::filter_bk::minrow);
     BOOST_REQUIRE_EQUAL(query.filter_tx_body_size(), 5u);
+    BOOST_REQUIRE_EQUAL(query.summary_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.layout_body_size(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
@@ -84,6 +87,8 @@ BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.validated_bk_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.filter_tx_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.filter_bk_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.summary_buckets(), 0u);
+    BOOST_REQUIRE_EQUAL(query.layout_buckets(), 0u);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
@@ -103,12 +108,14 @@ BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.candidate_records(), one);
     BOOST_REQUIRE_EQUAL(query.confirmed_records(), one);
     BOOST_REQUIRE_EQUAL(query.strong_tx_records(), one);
+    BOOST_REQUIRE_EQUAL(query.strong_array_records(), zero);
     BOOST_REQUIRE_EQUAL(query.ecdsa_records(), zero);
     BOOST_REQUIRE_EQUAL(query.schnorr_records(), zero);
     BOOST_REQUIRE_EQUAL(query.silent_records(), zero);
     BOOST_REQUIRE_EQUAL(query.duplicate_records(), zero);
     BOOST_REQUIRE_EQUAL(query.prevalid_records(), zero);
     BOOST_REQUIRE_EQUAL(query.filter_bk_records(), one);
+    BOOST_REQUIRE_EQUAL(query.summary_records(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__input_output_count__genesis__expected)
@@ -141,6 +148,35 @@ BOOST_AUTO_TEST_CASE(query_extent__optionals_enabled__default__true)
     BOOST_REQUIRE(query.initialize(test::genesis));
     BOOST_REQUIRE(query.address_enabled());
     BOOST_REQUIRE(query.filter_enabled());
+    BOOST_REQUIRE(!query.summary_enabled());
+    BOOST_REQUIRE(!query.layout_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__summary_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.summary_enabled());
+    BOOST_REQUIRE_EQUAL(query.summary_body_size(), schema::summary::minrow);
+    BOOST_REQUIRE_EQUAL(query.summary_records(), one);
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__layout_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.layout.buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.layout_enabled());
+    BOOST_REQUIRE_EQUAL(query.layout_body_size(), table::layout::slab_size(one));
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__address_enabled__disabled__false)
@@ -142,6 +142,30 @@ BOOST_AUTO_TEST_CASE(query_navigate__to_tx__transactions__expected)
     BOOST_REQUIRE_EQUAL(query.to_tx(test::block3.transactions_ptr()->front()->hash(true)), tx_link::terminal);
 }
 
+BOOST_AUTO_TEST_CASE(query_navigate__to_txs__hashes__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block2, test::context, false, false));
+
+    const hashes keys
+    {
+        test::block2.transactions_ptr()->front()->hash(true),
+        test::block3.transactions_ptr()->front()->hash(true),
+        test::genesis.transactions_ptr()->front()->hash(true),
+        test::block1.transactions_ptr()->front()->hash(true)
+    };
+
+    const tx_links expected{ 2, tx_link::terminal, 0, 1 };
+    BOOST_REQUIRE_EQUAL(query.to_txs(keys), expected);
+    BOOST_REQUIRE(query.to_txs(hashes{}).empty());
+}
+
 // to_filter
 // to_output
 
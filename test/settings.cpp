@@ -27,6 +27,9 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.mark_unconfirmable, true);
     BOOST_REQUIRE_EQUAL(configuration.interval_depth, 255u);
     BOOST_REQUIRE_EQUAL(configuration.fork_flags, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.dense_strong, false);
+    BOOST_REQUIRE_EQUAL(configuration.file_concurrency, 8u);
+    BOOST_REQUIRE_EQUAL(configuration.snapshot_deltas, 0u);
     BOOST_REQUIRE_EQUAL(configuration.path, "bitcoin");
 
     // Archives.
@@ -58,6 +61,8 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.strong_tx.buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx.size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx.rate, 5u);
+    BOOST_REQUIRE_EQUAL(configuration.strong_array.size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.strong_array.rate, 5u);
 
     // Caches.
     BOOST_REQUIRE_EQUAL(configuration.ecdsa.size, 1u);
@@ -88,6 +93,12 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.filter_tx.buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx.size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx.rate, 5u);
+    BOOST_REQUIRE_EQUAL(configuration.summary.buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.summary.size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.summary.rate, 5u);
+    BOOST_REQUIRE_EQUAL(configuration.layout.buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.layout.size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.layout.rate, 5u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -110,6 +110,209 @@ BOOST_AUTO_TEST_CASE(store__is_dirty__open_with_two_headers__true)
     BOOST_REQUIRE(!instance1.close(test::events));
 }
 
+// dense_strong
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(store__open__same_strong_mode__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.dense_strong = true;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE(!instance2.open(test::events));
+    BOOST_REQUIRE(!instance2.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__dense_strong_sparse_store__strong_mode)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    configuration.dense_strong = true;
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE_EQUAL(instance2.open(test::events), error::strong_mode);
+}
+
+BOOST_AUTO_TEST_CASE(store__open__sparse_strong_dense_store__strong_mode)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.dense_strong = true;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    configuration.dense_strong = false;
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE_EQUAL(instance2.open(test::events), error::strong_mode);
+}
+
+BOOST_AUTO_TEST_CASE(store__open__strong_array_missing__created)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    // A store created before the dense index has neither of its files.
+    const std::string name{ schema::indexes::strong_array };
+    const auto head = configuration.path / schema::dir::heads /
+        (name + schema::ext::head);
+    const auto body = configuration.path / (name + schema::ext::data);
+    BOOST_REQUIRE(test::remove(head));
+    BOOST_REQUIRE(test::remove(body));
+
+    store<database::mmap> instance2{ configuration };
+    query<store<database::mmap>> query2_{ instance2 };
+    BOOST_REQUIRE(!instance2.open(test::events));
+    BOOST_REQUIRE(test::exists(head));
+    BOOST_REQUIRE(test::exists(body));
+    BOOST_REQUIRE(query2_.is_confirmed_block(query2_.to_header(test::genesis.hash())));
+    BOOST_REQUIRE(!instance2.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__strong_array_body_missing__failure)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    // A table with one of its files is not added.
+    const std::string name{ schema::indexes::strong_array };
+    BOOST_REQUIRE(test::remove(configuration.path / (name + schema::ext::data)));
+
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE(instance2.open(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__summary_missing_disabled__created)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    const std::string name{ schema::optionals::summary };
+    const auto head = configuration.path / schema::dir::heads /
+        (name + schema::ext::head);
+    BOOST_REQUIRE(test::remove(head));
+    BOOST_REQUIRE(test::remove(configuration.path / (name + schema::ext::data)));
+
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE(!instance2.open(test::events));
+    BOOST_REQUIRE(test::exists(head));
+    BOOST_REQUIRE(!instance2.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__summary_missing_enabled__unbuilt_table)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    // Confirmed history of an older store is not summarized.
+    const std::string name{ schema::optionals::summary };
+    BOOST_REQUIRE(test::remove(configuration.path / schema::dir::heads / (name + schema::ext::head)));
+    BOOST_REQUIRE(test::remove(configuration.path / (name + schema::ext::data)));
+
+    configuration.summary.buckets = 8;
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE_EQUAL(instance2.open(test::events), error::unbuilt_table);
+    BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+
+    // Nothing was created, so the store opens with the summary disabled.
+    configuration.summary.buckets = 0;
+    store<database::mmap> instance3{ configuration };
+    BOOST_REQUIRE(!instance3.open(test::events));
+    BOOST_REQUIRE(!instance3.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__layout_missing_enabled__created)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    const std::string name{ schema::optionals::layout };
+    const auto head = configuration.path / schema::dir::heads /
+        (name + schema::ext::head);
+    BOOST_REQUIRE(test::remove(head));
+    BOOST_REQUIRE(test::remove(configuration.path / (name + schema::ext::data)));
+
+    // Genesis is not laid out, so its readers fall back to the txs table.
+    configuration.layout.buckets = 8;
+    store<database::mmap> instance2{ configuration };
+    query<store<database::mmap>> query2_{ instance2 };
+    BOOST_REQUIRE(!instance2.open(test::events));
+    BOOST_REQUIRE(test::exists(head));
+    BOOST_REQUIRE(query2_.layout_enabled());
+
+    size_t position{};
+    const auto genesis = query2_.to_header(test::genesis.hash());
+    BOOST_REQUIRE(query2_.get_tx_position(position, query2_.get_position_tx(genesis, 0), genesis));
+    BOOST_REQUIRE_EQUAL(position, 0u);
+    BOOST_REQUIRE_EQUAL(query2_.get_tx_keys(genesis).size(), 1u);
+    BOOST_REQUIRE(!instance2.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__open__fingerprint_width_mismatch__fingerprint_width)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+
+    store<database::mmap> instance1{ configuration };
+    query<store<database::mmap>> query1_{ instance1 };
+    BOOST_REQUIRE(!instance1.create(test::events));
+    BOOST_REQUIRE(query1_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance1.close(test::events));
+
+    // Rewrite the genesis output spine row as if stored in another width.
+    constexpr auto width = schema::address::minrow;
+    constexpr auto other = width == 4u ? 20u : 4u;
+    const auto spine = configuration.path / "archive_outs_address.data";
+    BOOST_REQUIRE_EQUAL(test::size(spine), width);
+    BOOST_REQUIRE(test::create(spine, std::string(other, 'x')));
+
+    store<database::mmap> instance2{ configuration };
+    BOOST_REQUIRE_EQUAL(instance2.open(test::events), error::fingerprint_width);
+    BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+}
+
 BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
 {
     const settings configuration{};
@@ -136,6 +339,8 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.confirmed_head_file(), "bitcoin/heads/index_confirmed.head");
     BOOST_REQUIRE_EQUAL(instance.strong_tx_head_file(), "bitcoin/heads/index_strong.head");
     BOOST_REQUIRE_EQUAL(instance.strong_tx_body_file(), "bitcoin/index_strong.data");
+    BOOST_REQUIRE_EQUAL(instance.strong_array_head_file(), "bitcoin/heads/index_strong_array.head");
+    BOOST_REQUIRE_EQUAL(instance.strong_array_body_file(), "bitcoin/index_strong_array.data");
 
     /// Cache.
     BOOST_REQUIRE_EQUAL(instance.duplicate_head_file(), "bitcoin/heads/cache_duplicate.head");
@@ -150,6 +355,10 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.filter_bk_body_file(), "bitcoin/option_filter_bk.data");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_head_file(), "bitcoin/heads/option_filter_tx.head");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_body_file(), "bitcoin/option_filter_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.summary_head_file(), "bitcoin/heads/option_summary.head");
+    BOOST_REQUIRE_EQUAL(instance.summary_body_file(), "bitcoin/option_summary.data");
+    BOOST_REQUIRE_EQUAL(instance.layout_head_file(), "bitcoin/heads/option_layout.head");
+    BOOST_REQUIRE_EQUAL(instance.layout_body_file(), "bitcoin/option_layout.data");
 
     /// Lock.
     BOOST_REQUIRE_EQUAL(instance.flush_lock_file(), "bitcoin/flush.lock");
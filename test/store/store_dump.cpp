@@ -42,4 +42,21 @@ BOOST_AUTO_TEST_CASE(store__dump__loaded__success)
     BOOST_REQUIRE(!instance.close(test::events));
 }
 
+BOOST_AUTO_TEST_CASE(store__dump__concurrent__copies_total)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.file_concurrency = 16;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.dump_(TEST_DIRECTORY));
+
+    const auto progress = instance.get_copy_progress();
+    BOOST_REQUIRE(is_nonzero(progress.total));
+    BOOST_REQUIRE_EQUAL(progress.bytes, progress.total);
+    BOOST_REQUIRE(test::exists(std::filesystem::path{ TEST_DIRECTORY } /
+        (std::string{ schema::archive::header } + schema::ext::head)));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
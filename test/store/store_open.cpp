@@ -97,4 +97,44 @@ BOOST_AUTO_TEST_CASE(store__open__created__success)
     BOOST_REQUIRE(!instance.close(test::events));
 }
 
+BOOST_AUTO_TEST_CASE(store__open__uncreated_concurrent__serial_code)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.file_concurrency = 1;
+    code serial{};
+    {
+        store<database::mmap> instance{ configuration };
+        serial = instance.open(test::events);
+    }
+
+    configuration.file_concurrency = 16;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(serial);
+    BOOST_REQUIRE_EQUAL(instance.open(test::events), serial);
+}
+
+BOOST_AUTO_TEST_CASE(store__open__concurrent__events_per_file)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.file_concurrency = 16;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    std::unordered_map<event_t, size_t> counts{};
+    const auto handler = [&](event_t event, table_t) NOEXCEPT
+    {
+        ++counts[event];
+    };
+
+    BOOST_REQUIRE(!instance.open(handler));
+    BOOST_REQUIRE(!instance.close(handler));
+    BOOST_REQUIRE(is_nonzero(counts[event_t::open_file]));
+    BOOST_REQUIRE_EQUAL(counts[event_t::load_file], counts[event_t::open_file]);
+    BOOST_REQUIRE_EQUAL(counts[event_t::unload_file], counts[event_t::open_file]);
+    BOOST_REQUIRE_EQUAL(counts[event_t::close_file], counts[event_t::open_file]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
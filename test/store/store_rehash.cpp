@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/map_store.hpp"
+
+// these include the slow tests (mmap)
+
+BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
+
+// rehash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(store__rehash__transactor_locked__transactor_lock)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    instance.transactor_mutex().lock();
+    BOOST_REQUIRE_EQUAL(instance.rehash(test::events), error::transactor_lock);
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__unchanged__success_snapshot_retained)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    BOOST_REQUIRE(!instance.rehash(test::events));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+    BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__resized__success_indexed)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    {
+        store<database::mmap> instance{ configuration };
+        query<store<database::mmap>> query_{ instance };
+        BOOST_REQUIRE(!instance.create(test::events));
+        BOOST_REQUIRE(query_.initialize(test::genesis));
+        BOOST_REQUIRE(!instance.snapshot(test::events));
+        BOOST_REQUIRE(!instance.close(test::events));
+    }
+
+    configuration.header.buckets *= 2u;
+    configuration.ins.buckets /= 2u;
+    configuration.tx.buckets = 1;
+    store<database::mmap> instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+
+    // Resized heads do not verify until rehashed.
+    BOOST_REQUIRE_EQUAL(instance.open(test::events), error::verify_table);
+    BOOST_REQUIRE(!instance.rehash(test::events));
+    BOOST_REQUIRE(!test::folder(configuration.path / schema::dir::primary));
+    BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(query_.is_initialized());
+    BOOST_REQUIRE(!query_.to_header(test::genesis.hash()).is_terminal());
+    BOOST_REQUIRE(!query_.to_tx(test::genesis.transactions_ptr()->front()->hash(false)).is_terminal());
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__enable_disabled__rehash_table_unlocked)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    {
+        test::map_store instance{ configuration };
+        BOOST_REQUIRE(!instance.create(test::events));
+        BOOST_REQUIRE(!instance.close(test::events));
+    }
+
+    // Disabled heads are not enabled, and failure precedes any relink.
+    configuration.summary.buckets = 16;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.rehash(test::events), error::rehash_table);
+    BOOST_REQUIRE(!test::exists(instance.flush_lock_file()));
+    BOOST_REQUIRE(!test::exists(instance.process_lock_file()));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__resized_with_unrestorable__rehash_table_intact)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    {
+        store<database::mmap> instance{ configuration };
+        query<store<database::mmap>> query_{ instance };
+        BOOST_REQUIRE(!instance.create(test::events));
+        BOOST_REQUIRE(query_.initialize(test::genesis));
+        BOOST_REQUIRE(!instance.snapshot(test::events));
+        BOOST_REQUIRE(!instance.close(test::events));
+    }
+
+    // Header is restorable and precedes outs, which is not restorable.
+    const settings original{ configuration };
+    configuration.header.buckets *= 2u;
+    configuration.outs.buckets *= 2u;
+    {
+        store<database::mmap> instance{ configuration };
+        BOOST_REQUIRE_EQUAL(instance.rehash(test::events), error::rehash_table);
+        BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+        BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+    }
+
+    // No head was relinked.
+    store<database::mmap> instance{ original };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(!query_.to_header(test::genesis.hash()).is_terminal());
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__resized_with_enable_disabled__rehash_table_intact)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    {
+        store<database::mmap> instance{ configuration };
+        query<store<database::mmap>> query_{ instance };
+        BOOST_REQUIRE(!instance.create(test::events));
+        BOOST_REQUIRE(query_.initialize(test::genesis));
+        BOOST_REQUIRE(!instance.snapshot(test::events));
+        BOOST_REQUIRE(!instance.close(test::events));
+    }
+
+    // Tx is resized and precedes summary, which cannot be enabled.
+    const settings original{ configuration };
+    configuration.tx.buckets *= 2u;
+    configuration.summary.buckets = 16;
+    {
+        store<database::mmap> instance{ configuration };
+        BOOST_REQUIRE_EQUAL(instance.rehash(test::events), error::rehash_table);
+        BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+        BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+    }
+
+    store<database::mmap> instance{ original };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(!query_.to_tx(test::genesis.transactions_ptr()->front()->hash(false)).is_terminal());
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__resized_with_unverified__verify_table_intact)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    {
+        store<database::mmap> instance{ configuration };
+        query<store<database::mmap>> query_{ instance };
+        BOOST_REQUIRE(!instance.create(test::events));
+        BOOST_REQUIRE(query_.initialize(test::genesis));
+        BOOST_REQUIRE(!instance.snapshot(test::events));
+        BOOST_REQUIRE(!instance.close(test::events));
+    }
+
+    // Header is prepared and precedes tx, whose body does not verify.
+    const auto header = configuration.path / schema::dir::heads /
+        (std::string{ schema::archive::header } + schema::ext::head);
+    const auto tx_body = configuration.path /
+        (std::string{ schema::archive::tx } + schema::ext::data);
+    const auto size = test::size(header);
+    BOOST_REQUIRE(test::create(tx_body, "x"));
+
+    configuration.header.buckets *= 2u;
+    configuration.tx.buckets *= 2u;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.rehash(test::events), error::verify_table);
+
+    // No head was replaced, snapshots are retained, and the store unlocked.
+    BOOST_REQUIRE_EQUAL(test::size(header), size);
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+    BOOST_REQUIRE(!test::folder(configuration.path / schema::dir::temporary));
+    BOOST_REQUIRE(!test::exists(test::flush_lock_file(configuration.path)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
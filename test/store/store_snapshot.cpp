@@ -20,6 +20,8 @@
 #include "../mocks/blocks.hpp"
 #include "../mocks/map_store.hpp"
 
+#include <numeric>
+
  // these include the slow tests (mmap)
 
 BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
@@ -45,4 +47,20 @@ BOOST_AUTO_TEST_CASE(store__snapshot__opened__success)
     BOOST_REQUIRE(!instance.close(test::events));
 }
 
+BOOST_AUTO_TEST_CASE(store__snapshot__concurrent__bodies_flushed)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.file_concurrency = 16;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+
+    // Each of the (unpruned) bodies records its flush duration.
+    const auto durations = instance.get_stats().flush_durations;
+    BOOST_REQUIRE_GE(std::accumulate(durations.begin(), durations.end(),
+        zero), 20u);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
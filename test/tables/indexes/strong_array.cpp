@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(strong_array_tests)
+
+using namespace system;
+const table::strong_array::put_block block1{ {}, 2, table::strong_array::merge(true, 0x0078f87f) };
+const table::strong_array::put_block block2{ {}, 2, table::strong_array::merge(false, 0x0078f87f) };
+const auto expected_head = base16_chunk
+(
+    "00000000"
+);
+const auto closed_head = base16_chunk
+(
+    "03000000"
+);
+const auto expected_body = base16_chunk
+(
+    "000000" // unwritten
+    "7ff8f8" // 0x0078f87f | 0x00800000
+    "7ff8f8" // 0x0078f87f | 0x00800000
+);
+const auto unstrong_body = base16_chunk
+(
+    "000000" // unwritten
+    "7ff878" // 0x0078f87f | 0x00000000
+    "7ff878" // 0x0078f87f | 0x00000000
+);
+
+BOOST_AUTO_TEST_CASE(strong_array__put_block__in_place__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::strong_array instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.expand(3u));
+
+    BOOST_REQUIRE(instance.set(instance.get_memory(), 1u, block1));
+    BOOST_REQUIRE_EQUAL(instance.count(), 3u);
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+
+    BOOST_REQUIRE(instance.set(instance.get_memory(), 1u, block2));
+    BOOST_REQUIRE_EQUAL(instance.count(), 3u);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), unstrong_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(strong_array__get__in_place__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::strong_array instance{ head_store, body_store };
+
+    table::strong_array::record out{};
+    BOOST_REQUIRE(instance.get(0u, out));
+    BOOST_REQUIRE(!out.positive());
+    BOOST_REQUIRE_EQUAL(out.header_fk(), 0u);
+
+    BOOST_REQUIRE(instance.get(2u, out));
+    BOOST_REQUIRE(out.positive());
+    BOOST_REQUIRE_EQUAL(out.header_fk(), 0x0078f87fu);
+    BOOST_REQUIRE_EQUAL(out.signed_block_fk, bit_or(0x0078f87fu, 0x00800000u));
+    BOOST_REQUIRE(!instance.get(3u, out));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
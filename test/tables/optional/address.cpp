@@ -76,7 +76,7 @@ BOOST_AUTO_TEST_CASE(address__it__co_bucket__all_candidates)
     BOOST_REQUIRE(instance.commit(ptr, 0u, { key1 }));
     BOOST_REQUIRE(instance.commit(ptr, 1u, { key2 }));
 
-    // Nothing is stored, so both rows are candidates for either key.
+    // Without a stored fragment both rows are candidates for either key.
     std::vector<table::outs::link::integer> links{};
     for (auto it = instance.it({ key1 }); it; ++it)
         links.push_back(*it);
@@ -92,6 +92,64 @@ BOOST_AUTO_TEST_CASE(address__it__co_bucket__all_candidates)
     BOOST_REQUIRE_EQUAL(out.out_fk, 0x7890abcdef_u64);
 }
 
+// Address spine with a four byte stored script hash fragment.
+struct fingerprint_address
+{
+    static constexpr size_t sk = 4;
+    static constexpr size_t pk = schema::address::pk;
+    using link = schema::address::link;
+    using key = keys::search<sk>;
+    static constexpr size_t minsize = zero;
+    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t size = minsize;
+    static constexpr size_t cell = link::size;
+};
+
+struct fingerprint_outs
+  : public hash_maps<fingerprint_address, table::outs_puts>
+{
+    using base = hash_maps<fingerprint_address, table::outs_puts>;
+    using base::hashmaps;
+    column<base, one> puts{ *this };
+};
+
+using fingerprint_storages = test::chunk_storages<fingerprint_address::minrow,
+    schema::outs::size>;
+const data_chunk expected_fingerprint_body
+{
+    0xff, 0xff, 0xff, 0xff,  // next->end
+    0xaa, 0x00, 0x00, 0x00,  // key1[8..12)
+    0x00, 0x00, 0x00, 0x00,  // next->0
+    0xbb, 0x00, 0x00, 0x00   // key2[8..12)
+};
+
+BOOST_AUTO_TEST_CASE(address__it__fingerprint__filters_co_bucket)
+{
+    test::chunk_storage head_store{};
+    fingerprint_storages body_store{ body_paths };
+    fingerprint_outs instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    const auto link = instance.allocate(2);
+    BOOST_REQUIRE(instance.puts.put(link, in));
+    const auto ptr = instance.get_memory();
+    BOOST_REQUIRE(instance.commit(ptr, 0u, { key1 }));
+    BOOST_REQUIRE(instance.commit(ptr, 1u, { key2 }));
+    BOOST_REQUIRE_EQUAL(body_store.buffers_.at(0), expected_fingerprint_body);
+
+    // The stored fragment excludes the co-bucket row of the other key.
+    std::vector<table::outs::link::integer> links{};
+    for (auto it = instance.it({ key1 }); it; ++it)
+        links.push_back(*it);
+
+    BOOST_REQUIRE_EQUAL(links.size(), 1u);
+    BOOST_REQUIRE_EQUAL(links.at(0), 0u);
+
+    table::outs::get_output out{};
+    BOOST_REQUIRE(instance.puts.get(links.at(0), out));
+    BOOST_REQUIRE_EQUAL(out.out_fk, 0x7890abcdef_u64);
+}
+
 BOOST_AUTO_TEST_CASE(address__enabled__no_buckets__false)
 {
     test::chunk_storage head_store{};
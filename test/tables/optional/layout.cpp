@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(layout_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(layout__put__block__expected)
+{
+    const auto& block = test::block2a;
+    const auto& txs = *block.transactions_ptr();
+    const auto number = txs.size();
+    BOOST_REQUIRE_GT(number, one);
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::layout instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(2, table::layout::put_ref{ {}, 42, block }));
+    BOOST_REQUIRE_EQUAL(body_store.buffer().size(),
+        table::layout::slab_size(number));
+
+    table::layout::get_hashes hashes{};
+    BOOST_REQUIRE(instance.at(2, hashes));
+    BOOST_REQUIRE_EQUAL(hashes.hashes.size(), number);
+    BOOST_REQUIRE(!instance.at(1, hashes));
+
+    auto light = chain::header::serialized_size() + variable_size(number);
+    auto heavy = light;
+    for (size_t position{}; position < number; ++position)
+    {
+        const auto& tx = *txs.at(position);
+        BOOST_REQUIRE_EQUAL(hashes.hashes.at(position), tx.hash(false));
+
+        const auto link = possible_narrow_cast<uint32_t>(42u + position);
+        table::layout::get_position by_link{ {}, link };
+        BOOST_REQUIRE(instance.at(2, by_link));
+        BOOST_REQUIRE_EQUAL(by_link.position, position);
+
+        table::layout::get_at_position by_position{ {}, position };
+        BOOST_REQUIRE(instance.at(2, by_position));
+        BOOST_REQUIRE_EQUAL(by_position.tx_fk, 42u + position);
+
+        table::layout::get_offset nominal{ {}, position, false };
+        BOOST_REQUIRE(instance.at(2, nominal));
+        BOOST_REQUIRE_EQUAL(nominal.offset, light);
+        BOOST_REQUIRE_EQUAL(nominal.size, tx.serialized_size(false));
+
+        table::layout::get_offset witness{ {}, position, true };
+        BOOST_REQUIRE(instance.at(2, witness));
+        BOOST_REQUIRE_EQUAL(witness.offset, heavy);
+        BOOST_REQUIRE_EQUAL(witness.size, tx.serialized_size(true));
+
+        // First and last byte of each tx map to its position.
+        table::layout::get_at_offset first{ {}, heavy, true };
+        table::layout::get_at_offset last{ {}, sub1(heavy + witness.size), true };
+        BOOST_REQUIRE(instance.at(2, first));
+        BOOST_REQUIRE(instance.at(2, last));
+        BOOST_REQUIRE_EQUAL(first.position, position);
+        BOOST_REQUIRE_EQUAL(last.position, position);
+
+        light += nominal.size;
+        heavy += witness.size;
+    }
+
+    BOOST_REQUIRE_EQUAL(light, block.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(heavy, block.serialized_size(true));
+}
+
+BOOST_AUTO_TEST_CASE(layout__get__out_of_range__false)
+{
+    const auto& block = test::block2a;
+    const auto number = block.transactions();
+    const auto header = chain::header::serialized_size();
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::layout instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(0, table::layout::put_ref{ {}, 42, block }));
+
+    table::layout::get_position below{ {}, 41 };
+    table::layout::get_position above{ {}, possible_narrow_cast<uint32_t>(42u + number) };
+    table::layout::get_at_position position{ {}, number };
+    table::layout::get_offset offset{ {}, number, false };
+    table::layout::get_at_offset in_header{ {}, sub1(header), false };
+    table::layout::get_at_offset at_end{ {}, block.serialized_size(false), false };
+    BOOST_REQUIRE(!instance.at(0, below));
+    BOOST_REQUIRE(!instance.at(0, above));
+    BOOST_REQUIRE(!instance.at(0, position));
+    BOOST_REQUIRE(!instance.at(0, offset));
+    BOOST_REQUIRE(!instance.at(0, in_header));
+    BOOST_REQUIRE(!instance.at(0, at_end));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(summary_tests)
+
+using namespace system;
+constexpr auto key1 = from_uintx(uint256_t(1));
+constexpr auto key2 = from_uintx(uint256_t(2));
+const table::summary::record summary1{ {}, 0x0102030405060708, 0x11121314, 0x21222324, 0x00313233, 0x00414243 };
+const table::summary::record summary2{ {}, 0x00000000000000ff, 0x00000001, 0x00000000, 0x00000005, 0x00000005 };
+const table::summary::record summary3{ {}, 0x0000000000000042, 0x00000002, 0x00000001, 0x00000005, 0x00000007 };
+
+// One bucket, so the second row links to the first.
+const auto expected_body = base16_chunk
+(
+    "ffffffff" // next->end
+    "0100000000000000000000000000000000000000000000000000000000000000" // key1
+    "0807060504030201" // balance
+    "14131211"         // funded
+    "24232221"         // spent
+    "333231"           // first
+    "434241"           // last
+
+    "00000000" // next->
+    "0200000000000000000000000000000000000000000000000000000000000000" // key2
+    "ff00000000000000" // balance
+    "01000000"         // funded
+    "00000000"         // spent
+    "050000"           // first
+    "050000"           // last
+);
+const auto updated_body = base16_chunk
+(
+    "ffffffff" // next->end
+    "0100000000000000000000000000000000000000000000000000000000000000" // key1
+    "0807060504030201" // balance
+    "14131211"         // funded
+    "24232221"         // spent
+    "333231"           // first
+    "434241"           // last
+
+    "00000000" // next->
+    "0200000000000000000000000000000000000000000000000000000000000000" // key2
+    "4200000000000000" // balance
+    "02000000"         // funded
+    "01000000"         // spent
+    "050000"           // first
+    "070000"           // last
+);
+
+BOOST_AUTO_TEST_CASE(summary__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 1 };
+    BOOST_REQUIRE(instance.create());
+
+    table::summary::link link1{};
+    BOOST_REQUIRE(instance.put_link(link1, key1, summary1));
+    BOOST_REQUIRE_EQUAL(link1, 0u);
+
+    table::summary::link link2{};
+    BOOST_REQUIRE(instance.put_link(link2, key2, summary2));
+    BOOST_REQUIRE_EQUAL(link2, 1u);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+
+    table::summary::record out{};
+    BOOST_REQUIRE(instance.find(key1, out));
+    BOOST_REQUIRE(out == summary1);
+    BOOST_REQUIRE(instance.find(key2, out));
+    BOOST_REQUIRE(out == summary2);
+}
+
+BOOST_AUTO_TEST_CASE(summary__update__committed__overwrites_element_only)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(key1, summary1));
+    BOOST_REQUIRE(instance.put(key2, summary2));
+
+    table::summary::record out{};
+    const auto link = instance.find_link(key2, out);
+    BOOST_REQUIRE_EQUAL(link, 1u);
+    BOOST_REQUIRE(instance.update(link, summary3));
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), updated_body);
+
+    BOOST_REQUIRE(instance.find(key2, out));
+    BOOST_REQUIRE(out == summary3);
+    BOOST_REQUIRE(instance.find(key1, out));
+    BOOST_REQUIRE(out == summary1);
+}
+
+BOOST_AUTO_TEST_CASE(summary__update__terminal__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(!instance.update(table::summary::link{}, summary1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,416 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+namespace initchain {
+
+using namespace system;
+using namespace system::chain;
+
+constexpr uint64_t subsidy = 50'0000'0000;
+constexpr uint64_t value = 1'0000;
+constexpr uint32_t legacy_version = 1;
+constexpr uint32_t segwit_version = 2;
+constexpr uint32_t versionbits = 0x20000000;
+
+// Placeholder unlocking data, sized as mainnet (scripts are not validated).
+constexpr size_t signature_size = 72;
+constexpr size_t key_size = 33;
+constexpr size_t schnorr_size = 64;
+
+// Bound geometric outliers (very low mean probabilities).
+constexpr double maximum_count = 10'000.0;
+
+generator::generator(const profile& config, const header& genesis) NOEXCEPT
+  : config_(config),
+    engine_(config.seed),
+    previous_(genesis.hash()),
+    timestamp_(genesis.timestamp())
+{
+}
+
+size_t generator::height() const NOEXCEPT
+{
+    return height_;
+}
+
+size_t generator::unspent() const NOEXCEPT
+{
+    return tracked_;
+}
+
+block generator::next() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    mature();
+
+    const auto count = block_txs();
+    transactions txs{};
+    txs.reserve(add1(count));
+    txs.push_back(coinbase());
+
+    // Stops early (short block) when there is nothing left to spend.
+    for (size_t tx{}; tx < count; ++tx)
+        if (!spend(txs))
+            break;
+
+    // Outputs become spendable in the next block.
+    for (auto& output: pending_)
+    {
+        output.height = possible_narrow_cast<uint32_t>(height_);
+        pool_.push_back(std::move(output));
+    }
+
+    pending_.clear();
+    compact();
+
+    // Merkle root is not computed (not validated, not required by store).
+    timestamp_ += spacing;
+    const auto nonce = possible_narrow_cast<uint32_t>(height_);
+    header head
+    {
+        height_ < config_.segwit_height ? legacy_version : versionbits,
+        previous_,
+        null_hash,
+        timestamp_,
+        bits,
+        nonce
+    };
+
+    previous_ = head.hash();
+    head.set_hash(hash_digest{ previous_ });
+    ++height_;
+    return block{ std::move(head), std::move(txs) };
+    BC_POP_WARNING()
+}
+
+// random
+// ----------------------------------------------------------------------------
+
+double generator::uniform() NOEXCEPT
+{
+    // 53 bits of the engine in [0, 1).
+    constexpr auto scale = 1.0 / static_cast<double>(power2<uint64_t>(53u));
+    return static_cast<double>(engine_() >> 11) * scale;
+}
+
+size_t generator::geometric(double mean) NOEXCEPT
+{
+    // One plus geometric, where p = 1 / mean.
+    if (mean <= 1.0)
+        return one;
+
+    const auto sample = std::log(1.0 - uniform()) / std::log(1.0 - 1.0 / mean);
+    return one + static_cast<size_t>(std::min(sample, maximum_count));
+}
+
+size_t generator::exponential(double mean) NOEXCEPT
+{
+    if (mean <= 0.0)
+        return zero;
+
+    const auto sample = -std::log(1.0 - uniform()) * mean;
+    return static_cast<size_t>(std::min(sample,
+        static_cast<double>(height_)));
+}
+
+// shape
+// ----------------------------------------------------------------------------
+
+size_t generator::block_txs() const NOEXCEPT
+{
+    if (is_zero(config_.ramp) || height_ >= config_.ramp)
+        return config_.txs;
+
+    return (config_.txs * height_) / config_.ramp;
+}
+
+size_t generator::next_address() NOEXCEPT
+{
+    if (is_zero(config_.addresses))
+        return zero;
+
+    const auto sample = std::pow(uniform(), std::max(config_.skew, 1.0));
+    return std::min(static_cast<size_t>(sample * config_.addresses),
+        sub1(config_.addresses));
+}
+
+generator::kind generator::next_kind() NOEXCEPT
+{
+    if (height_ >= config_.taproot_height && uniform() < config_.taproot)
+        return kind::p2tr;
+
+    if (height_ >= config_.segwit_height && uniform() < config_.segwit)
+        return kind::p2wpkh;
+
+    return kind::p2pkh;
+}
+
+script generator::to_script(kind type, size_t address) const NOEXCEPT
+{
+    const auto key = to_little_endian<uint64_t>(address);
+    switch (type)
+    {
+        case kind::p2wpkh:
+            return script
+            {
+                operations
+                {
+                    operation{ opcode::push_size_0 },
+                    operation{ to_chunk(bitcoin_short_hash(key)), false }
+                }
+            };
+        case kind::p2tr:
+            return script
+            {
+                operations
+                {
+                    operation{ opcode::push_positive_1 },
+                    operation{ to_chunk(sha256_hash(key)), false }
+                }
+            };
+        default:
+        case kind::p2pkh:
+            return script
+            {
+                script::to_pay_key_hash_pattern(bitcoin_short_hash(key))
+            };
+    }
+}
+
+input generator::to_input(const utxo& prevout) const NOEXCEPT
+{
+    switch (prevout.type)
+    {
+        case kind::p2wpkh:
+            return input
+            {
+                point{ prevout.hash, prevout.index },
+                script{},
+                witness
+                {
+                    data_stack
+                    {
+                        data_chunk(signature_size, 0x30),
+                        data_chunk(key_size, 0x02)
+                    }
+                },
+                max_uint32
+            };
+        case kind::p2tr:
+            return input
+            {
+                point{ prevout.hash, prevout.index },
+                script{},
+                witness
+                {
+                    data_stack
+                    {
+                        data_chunk(schnorr_size, 0x01)
+                    }
+                },
+                max_uint32
+            };
+        default:
+        case kind::p2pkh:
+            return input
+            {
+                point{ prevout.hash, prevout.index },
+                script
+                {
+                    operations
+                    {
+                        operation{ data_chunk(signature_size, 0x30), false },
+                        operation{ data_chunk(key_size, 0x02), false }
+                    }
+                },
+                witness{},
+                max_uint32
+            };
+    }
+}
+
+outputs generator::to_outputs(std::vector<kind>& types, size_t count,
+    uint64_t amount) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    outputs out{};
+    out.reserve(count);
+    types.reserve(count);
+    for (size_t output{}; output < count; ++output)
+    {
+        types.push_back(next_kind());
+        out.emplace_back(amount, to_script(types.back(), next_address()));
+    }
+
+    return out;
+    BC_POP_WARNING()
+}
+
+// transactions
+// ----------------------------------------------------------------------------
+
+transaction generator::coinbase() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    // Height as locktime and sequence makes each coinbase unique (bip30).
+    const auto unique = possible_narrow_cast<uint32_t>(height_);
+    std::vector<kind> types{};
+    transaction tx
+    {
+        legacy_version,
+        inputs
+        {
+            input{ point{}, script{}, witness{}, unique }
+        },
+        to_outputs(types, one, subsidy),
+        unique
+    };
+
+    const auto hash = tx.hash(false);
+    tx.set_nominal_hash(hash_digest{ hash });
+    track(hash, types, true);
+    return tx;
+    BC_POP_WARNING()
+}
+
+bool generator::spend(transactions& txs) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto count = geometric(config_.inputs);
+    inputs ins{};
+    ins.reserve(count);
+
+    utxo prevout{};
+    while (ins.size() < count && select(prevout))
+        ins.push_back(to_input(prevout));
+
+    if (ins.empty())
+        return false;
+
+    std::vector<kind> types{};
+    const auto version = height_ < config_.segwit_height ? legacy_version :
+        segwit_version;
+
+    txs.emplace_back(version, std::move(ins),
+        to_outputs(types, geometric(config_.outputs), value), 0);
+
+    auto& tx = txs.back();
+    const auto hash = tx.hash(false);
+    tx.set_nominal_hash(hash_digest{ hash });
+    track(hash, types, false);
+    return true;
+    BC_POP_WARNING()
+}
+
+// unspent pool
+// ----------------------------------------------------------------------------
+
+bool generator::select(utxo& out) NOEXCEPT
+{
+    if (spent_ == pool_.size())
+        return false;
+
+    const auto is_unspent = [](const utxo& item) NOEXCEPT
+    {
+        return !item.spent;
+    };
+
+    // Nearest unspent at or above the sampled age, otherwise nearest below.
+    const auto age = exponential(config_.age);
+    const auto target = height_ - age;
+    const auto start = std::lower_bound(pool_.begin(), pool_.end(), target,
+        [](const utxo& item, size_t height) NOEXCEPT
+        {
+            return item.height < height;
+        });
+
+    auto it = std::find_if(start, pool_.end(), is_unspent);
+    if (it == pool_.end())
+        it = std::prev(std::find_if(std::make_reverse_iterator(start),
+            pool_.rend(), is_unspent).base());
+
+    it->spent = true;
+    out = *it;
+    ++spent_;
+    --tracked_;
+    return true;
+}
+
+void generator::track(const hash_digest& hash, const std::vector<kind>& types,
+    bool coinbase) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto height = possible_narrow_cast<uint32_t>(height_);
+    const auto push = [&](auto& target) NOEXCEPT
+    {
+        // Untracked outputs are never spent.
+        for (uint32_t index{}; index < types.size(); ++index)
+        {
+            if (tracked_ >= config_.utxos)
+                return;
+
+            target.push_back({ hash, index, height, types.at(index),
+                coinbase, false });
+
+            ++tracked_;
+        }
+    };
+
+    if (coinbase)
+        push(maturing_);
+    else
+        push(pending_);
+    BC_POP_WARNING()
+}
+
+void generator::mature() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    while (!maturing_.empty() && maturing_.front().height + maturity <= height_)
+    {
+        auto output = std::move(maturing_.front());
+        output.height = possible_narrow_cast<uint32_t>(height_);
+        pool_.push_back(std::move(output));
+        maturing_.pop_front();
+    }
+    BC_POP_WARNING()
+}
+
+void generator::compact() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (spent_ > to_half(pool_.size()))
+    {
+        std::erase_if(pool_, [](const utxo& item) NOEXCEPT
+        {
+            return item.spent;
+        });
+
+        spent_ = zero;
+    }
+    BC_POP_WARNING()
+}
+
+} // namespace initchain
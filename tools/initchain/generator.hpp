@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TOOLS_INITCHAIN_GENERATOR_HPP
+#define LIBBITCOIN_DATABASE_TOOLS_INITCHAIN_GENERATOR_HPP
+
+#include <deque>
+#include <random>
+#include <vector>
+#include <bitcoin/database.hpp>
+
+namespace initchain {
+
+using namespace bc;
+
+/// Shape of the synthetic chain, deterministic for a given profile.
+/// Defaults approximate mainnet through height 800,000 (about 1bn txs).
+struct profile
+{
+    /// Top block height (genesis excluded from generation).
+    size_t height{ 800'000 };
+
+    /// Random engine seed (same seed and profile produce the same chain).
+    uint64_t seed{ 42 };
+
+    /// Non-coinbase txs per block at full ramp, linear from zero to ramp.
+    size_t txs{ 2'000 };
+    size_t ramp{ 600'000 };
+
+    /// Mean inputs and outputs per non-coinbase tx (geometric, minimum one).
+    double inputs{ 2.0 };
+    double outputs{ 2.5 };
+
+    /// Mean spend age in blocks (exponential, over the unspent pool).
+    double age{ 5'000.0 };
+
+    /// Distinct addresses and reuse skew (one is uniform, higher values
+    /// concentrate outputs on fewer addresses).
+    size_t addresses{ 10'000'000 };
+    double skew{ 3.0 };
+
+    /// Output script mix, fractions of outputs above activation heights.
+    size_t segwit_height{ 481'824 };
+    size_t taproot_height{ 709'632 };
+    double segwit{ 0.6 };
+    double taproot{ 0.1 };
+
+    /// Maximum tracked unspent outputs (others are never spent), bounds
+    /// generator memory at about 48 bytes per output.
+    size_t utxos{ 50'000'000 };
+};
+
+/// Streaming generator of blocks chained above the given genesis hash.
+/// Spends only outputs of prior blocks, and coinbase outputs only once
+/// mature, so that every block is confirmable when archived in order.
+class generator
+{
+public:
+    static constexpr size_t maturity = 100;
+    static constexpr uint32_t bits = 0x1d00ffff;
+    static constexpr uint32_t spacing = 600;
+
+    generator(const profile& config, const system::chain::header& genesis)
+      NOEXCEPT;
+
+    /// Height of the block to be returned by next().
+    size_t height() const NOEXCEPT;
+
+    /// Tracked unspent (spendable or maturing) outputs.
+    size_t unspent() const NOEXCEPT;
+
+    /// Generate the next block.
+    system::chain::block next() NOEXCEPT;
+
+private:
+    enum class kind : uint8_t
+    {
+        p2pkh,
+        p2wpkh,
+        p2tr
+    };
+
+    struct utxo
+    {
+        system::hash_digest hash;
+        uint32_t index;
+        uint32_t height;
+        kind type;
+        bool coinbase;
+        bool spent;
+    };
+
+    using utxos = std::vector<utxo>;
+
+    // Portable (std distributions are implementation-defined).
+    double uniform() NOEXCEPT;
+    size_t geometric(double mean) NOEXCEPT;
+    size_t exponential(double mean) NOEXCEPT;
+
+    size_t block_txs() const NOEXCEPT;
+    size_t next_address() NOEXCEPT;
+    kind next_kind() NOEXCEPT;
+    system::chain::script to_script(kind type, size_t address) const NOEXCEPT;
+    system::chain::input to_input(const utxo& prevout) const NOEXCEPT;
+    system::chain::outputs to_outputs(std::vector<kind>& types,
+        size_t count, uint64_t value) NOEXCEPT;
+    system::chain::transaction coinbase() NOEXCEPT;
+    bool spend(system::chain::transactions& txs) NOEXCEPT;
+    bool select(utxo& out) NOEXCEPT;
+    void track(const system::hash_digest& hash,
+        const std::vector<kind>& types, bool coinbase) NOEXCEPT;
+    void mature() NOEXCEPT;
+    void compact() NOEXCEPT;
+
+    const profile config_;
+    std::mt19937_64 engine_;
+    system::hash_digest previous_;
+    uint32_t timestamp_;
+    size_t height_{ one };
+    size_t spent_{};
+    size_t tracked_{};
+
+    // Ordered by pool entry height (lazily deleted, periodically compacted).
+    utxos pool_{};
+
+    // Outputs of the current block, and coinbase outputs awaiting maturity.
+    utxos pending_{};
+    std::deque<utxo> maturing_{};
+};
+
+} // namespace initchain
+
+#endif
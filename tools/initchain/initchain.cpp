@@ -16,9 +16,274 @@
  * You should have received a copy of the GNU Affero General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
 #include <bitcoin/database.hpp>
+#include "generator.hpp"
 
-int main(int, char**)
+using namespace bc;
+using namespace bc::database;
+using namespace initchain;
+using namespace std::chrono;
+
+using store_t = store<mmap>;
+using query_t = query<store_t>;
+
+// Per-phase accumulated duration.
+struct phase
+{
+    const char* name;
+    steady_clock::duration elapsed{};
+};
+
+enum phases : size_t { generate, archive, confirm, organize, count };
+
+static void usage() NOEXCEPT
+{
+    std::cerr
+        << "initchain <directory> [name=value]..." << std::endl
+        << "Generate a deterministic synthetic chain into a new store."
+        << std::endl
+        << "  height, seed, txs, ramp, inputs, outputs, age, addresses, skew,"
+        << std::endl
+        << "  segwit_height, taproot_height, segwit, taproot, utxos (profile)"
+        << std::endl
+        << "  confirm (1: block_confirmable each block, 0: skip)" << std::endl
+        << "  interval (blocks per progress line), buckets (percent of"
+        << " estimate)" << std::endl;
+}
+
+static bool parse(profile& out, bool& confirmed, size_t& interval,
+    size_t& buckets, const std::string& argument) NOEXCEPT
+{
+    const auto split = argument.find('=');
+    if (split == std::string::npos)
+        return false;
+
+    const auto name = argument.substr(zero, split);
+    const auto text = argument.substr(add1(split));
+    char* end{};
+    const auto real = std::strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0' || real < 0.0)
+        return false;
+
+    const auto number = static_cast<size_t>(real);
+    if (name == "height") out.height = number;
+    else if (name == "seed") out.seed = number;
+    else if (name == "txs") out.txs = number;
+    else if (name == "ramp") out.ramp = number;
+    else if (name == "inputs") out.inputs = real;
+    else if (name == "outputs") out.outputs = real;
+    else if (name == "age") out.age = real;
+    else if (name == "addresses") out.addresses = number;
+    else if (name == "skew") out.skew = real;
+    else if (name == "segwit_height") out.segwit_height = number;
+    else if (name == "taproot_height") out.taproot_height = number;
+    else if (name == "segwit") out.segwit = real;
+    else if (name == "taproot") out.taproot = real;
+    else if (name == "utxos") out.utxos = number;
+    else if (name == "confirm") confirmed = !is_zero(number);
+    else if (name == "interval") interval = number;
+    else if (name == "buckets") buckets = number;
+    else return false;
+    return true;
+}
+
+// Size hash tables to the expected chain (load factor about one).
+static settings configure(const std::filesystem::path& directory,
+    const profile& config, size_t percent) NOEXCEPT
+{
+    const auto bucket = [percent](double estimate) NOEXCEPT
+    {
+        const auto scaled = estimate * static_cast<double>(percent) / 100.0;
+        return static_cast<uint32_t>(std::clamp(scaled, 1.0,
+            static_cast<double>(max_uint32)));
+    };
+
+    // Transactions over the linear ramp and the plateau above it.
+    const auto top = static_cast<double>(config.height);
+    const auto ramp = std::min(static_cast<double>(config.ramp), top);
+    const auto txs = static_cast<double>(config.txs) *
+        ((top - ramp) + (ramp / 2.0)) + top;
+
+    settings out{};
+    out.path = directory;
+    out.header.buckets = bucket(top);
+    out.txs.buckets = bucket(top);
+    out.candidate.buckets = bucket(top);
+    out.confirmed.buckets = bucket(top);
+    out.prevout.buckets = bucket(top);
+    out.validated_bk.buckets = bucket(top);
+    out.tx.buckets = bucket(txs);
+    out.strong_tx.buckets = bucket(txs);
+    out.validated_tx.buckets = bucket(txs);
+    out.ins.buckets = bucket(txs * config.inputs);
+    out.outs.buckets = bucket(static_cast<double>(config.addresses));
+    return out;
+}
+
+static double seconds(const steady_clock::duration& elapsed) NOEXCEPT
+{
+    return duration_cast<duration<double>>(elapsed).count();
+}
+
+static double rate(size_t count, const steady_clock::duration& elapsed)
+    NOEXCEPT
+{
+    const auto time = seconds(elapsed);
+    return time > 0.0 ? static_cast<double>(count) / time : 0.0;
+}
+
+static void report(std::ostream& out, size_t height, size_t blocks,
+    size_t txs, size_t unspent, const phase (&timers)[count]) NOEXCEPT
 {
-    return 0;
+    out << height << '\t' << txs << '\t' << unspent;
+    for (const auto& timer: timers)
+        out << '\t' << timer.name << ':'
+            << static_cast<uint64_t>(rate(blocks, timer.elapsed)) << "bps/"
+            << static_cast<uint64_t>(rate(txs, timer.elapsed)) << "tps";
+
+    out << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        usage();
+        return -1;
+    }
+
+    profile config{};
+    auto confirmed = true;
+    size_t interval{ 10'000 };
+    size_t buckets{ 100 };
+    for (auto arg = 2; arg < argc; ++arg)
+    {
+        if (!parse(config, confirmed, interval, buckets, argv[arg]))
+        {
+            std::cerr << "Invalid argument: " << argv[arg] << std::endl;
+            usage();
+            return -1;
+        }
+    }
+
+    const auto configuration = configure(argv[1], config, buckets);
+    const auto handler = [](auto, auto) NOEXCEPT {};
+    if (!file::clear_directory(configuration.path))
+    {
+        std::cerr << "Failed to clear directory." << std::endl;
+        return -1;
+    }
+
+    store_t store{ configuration };
+    query_t query{ store };
+    const system::chain::block genesis
+    {
+        system::settings{ system::chain::selection::mainnet }.genesis_block
+    };
+
+    if (const auto ec = store.create(handler))
+    {
+        std::cerr << "Create failed: " << ec.message() << std::endl;
+        return -1;
+    }
+
+    if (!query.initialize(genesis))
+    {
+        std::cerr << "Initialize failed." << std::endl;
+        /* code */ store.close(handler);
+        return -1;
+    }
+
+    phase timers[count]
+    {
+        { "generate" }, { "archive" }, { "confirm" }, { "organize" }
+    };
+
+    const auto time = [&timers](phases index, auto&& function) NOEXCEPT
+    {
+        const auto start = steady_clock::now();
+        auto result = function();
+        timers[index].elapsed += steady_clock::now() - start;
+        return result;
+    };
+
+    generator chain{ config, genesis.header() };
+    size_t txs{};
+    code ec{};
+
+    std::cout << "height\ttxs\tunspent\tphases" << std::endl;
+    while (!ec && chain.height() <= config.height)
+    {
+        const auto height = chain.height();
+        const auto block = time(generate, [&]() NOEXCEPT
+        {
+            return chain.next();
+        });
+
+        txs += block.transactions();
+        const auto mtp = block.header().timestamp();
+        const context ctx{ 0, possible_narrow_cast<uint32_t>(height), mtp };
+
+        header_link link{};
+        ec = time(archive, [&]() NOEXCEPT
+        {
+            return query.set_code(link, block, ctx, false, false);
+        });
+
+        if (!ec && confirmed)
+        {
+            ec = time(confirm, [&]() NOEXCEPT -> code
+            {
+                if (const auto fault = query.block_confirmable(link))
+                    return fault;
+
+                return query.set_block_confirmable(link) ? error::success :
+                    error::integrity;
+            });
+        }
+
+        if (!ec)
+        {
+            ec = time(organize, [&]() NOEXCEPT -> code
+            {
+                return query.push_candidate(link) &&
+                    query.push_confirmed(link, true) ? error::success :
+                    error::integrity;
+            });
+        }
+
+        if (!ec && !is_zero(interval) && (is_zero(height % interval) ||
+            height == config.height))
+            report(std::cout, height, height, txs, chain.unspent(), timers);
+
+        if (ec)
+            std::cerr << "Failed at " << height << ": " << ec.message()
+                << std::endl;
+    }
+
+    const auto start = steady_clock::now();
+    const auto closed = store.close(handler);
+    const auto close = steady_clock::now() - start;
+
+    std::cout << std::endl << "phase\tseconds\tblocks/s\ttxs/s" << std::endl;
+    const auto blocks = sub1(chain.height());
+    for (const auto& timer: timers)
+        std::cout << timer.name << '\t' << seconds(timer.elapsed) << '\t'
+            << rate(blocks, timer.elapsed) << '\t'
+            << rate(txs, timer.elapsed) << std::endl;
+
+    std::cout << "close" << '\t' << seconds(close) << std::endl;
+    if (closed)
+    {
+        std::cerr << "Close failed: " << closed.message() << std::endl;
+        return -1;
+    }
+
+    return ec ? -1 : 0;
 }